@@ -1,7 +1,9 @@
-#version 330 core
-in vec3 ourColor;
+#version 430 core
+
+in vec3 vColor;
 out vec4 FragColor;
 
-void main(){
-    FragColor = vec4(ourColor, 1.0);
-};
\ No newline at end of file
+void main()
+{
+    FragColor = vec4(vColor, 1.0);
+}
@@ -1,15 +1,23 @@
-#version 330 core
-layout (location = 0) in vec3 aPos;
-layout (location = 1) in vec3 aNormal;
-layout (location = 2) in vec3 aColor;
+#version 430 core
+#include "splat_common.glsl"
 
-out vec3 ourColor;
-
-uniform mat4 model;
+// 点云预览：每个高斯中心画一个点，颜色只取 0 阶球谐（与视角无关，不读高阶系数）
 uniform mat4 view;
 uniform mat4 projection;
+uniform float u_pointSize;
+
+out vec3 vColor;
 
-void main(){
-    gl_Position = projection * view * model * vec4(aPos, 1.0);
-    ourColor = aColor;
-};
\ No newline at end of file
+void main()
+{
+    uint splatIndex = uint(gl_VertexID);
+    gl_PointSize = u_pointSize;
+    // 几乎透明的高斯在完整渲染中也看不见，预览时同样丢弃
+    if (splatOpacity(splatIndex) < SPLAT_ALPHA_CUTOFF)
+    {
+        gl_Position = vec4(0.0, 0.0, 2.0, 1.0);
+        return;
+    }
+    gl_Position = projection * view * vec4(splatPosition(splatIndex), 1.0);
+    vColor = evaluateSplatSH(splatIndex, vec3(0.0, 0.0, 1.0), 0);
+}
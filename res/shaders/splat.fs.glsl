@@ -0,0 +1,25 @@
+#version 430 core
+
+// 不写深度，discard 不影响深度缓冲，可强制提前深度测试（配合深度预通道拒绝被遮挡的片元）
+layout(early_fragment_tests) in;
+
+flat in vec3 vColor;
+flat in vec4 vConicOpacity;
+in vec2 vOffset;
+
+out vec4 FragColor;
+
+void main()
+{
+    vec2 d = vOffset;
+    float power = -0.5 * (vConicOpacity.x * d.x * d.x + vConicOpacity.z * d.y * d.y) - vConicOpacity.y * d.x * d.y;
+    if (power > 0.0)
+        discard;
+
+    float alpha = min(0.99, vConicOpacity.w * exp(power));
+    if (alpha < 1.0 / 255.0)
+        discard;
+
+    // 预乘 alpha，配合 glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA) 从后往前合成
+    FragColor = vec4(vColor * alpha, alpha);
+}
@@ -0,0 +1,103 @@
+#version 430 core
+#include "splat_common.glsl"
+
+// 每个实例一个高斯：实例号 -> 排序后（从后往前）的高斯下标
+layout(std430, binding = 1) readonly buffer SplatOrderBuffer { uint splatOrder[]; };
+// 计算着色器预处理的结果（splat_preprocess.cs.glsl），u_preprocessed 为 1 时使用
+layout(std430, binding = 2) readonly buffer PreprocessedBuffer { PreprocessedSplat preprocessed[]; };
+layout(std430, binding = 4) readonly buffer DrawCommandBuffer { uint drawCommand[4]; };
+
+uniform mat4 view;
+uniform mat4 projection;
+uniform vec3 u_viewPos;
+uniform vec2 u_viewport;    // 渲染目标尺寸（像素）
+uniform vec2 u_focal;       // 像素焦距
+uniform vec2 u_tanHalfFov;
+uniform float u_nearClip;
+// 深度预通道：> 0 时按实例号倒序（从前往后）绘制，跳过不透明度低于该值的高斯且不求颜色；主通道为 0
+uniform float u_depthPrepassAlpha;
+uniform uint u_instanceCount;
+// 加权混合 OIT 模式下未经排序：为 1 时实例号直接作为高斯下标（不读索引缓冲）
+uniform int u_identityOrder;
+// 间接绘制：实例数只在 GPU 上（drawCommand[1]），投影与颜色已由计算着色器求出
+uniform int u_preprocessed;
+
+// 预通道与主通道由不同程序绘制，深度须逐位一致才能以 GL_LEQUAL 通过自身写入的深度
+invariant gl_Position;
+
+flat out vec3 vColor;
+flat out vec4 vConicOpacity; // 逆协方差 (a, b, c) + 不透明度
+flat out float vDepth;       // 视空间深度（OIT 权重使用）
+out vec2 vOffset;            // 相对屏幕中心的像素偏移
+
+const vec2 QUAD_CORNERS[4] = vec2[4](vec2(-1.0, -1.0), vec2(1.0, -1.0), vec2(-1.0, 1.0), vec2(1.0, 1.0));
+
+void main()
+{
+    // 被剔除的实例输出到裁剪体之外，图元整体被丢弃
+    gl_Position = vec4(0.0, 0.0, 2.0, 1.0);
+
+    bool depthPrepass = u_depthPrepassAlpha > 0.0;
+    uint instanceCount = u_preprocessed != 0 ? drawCommand[1] : u_instanceCount;
+    uint instance = depthPrepass ? instanceCount - 1u - uint(gl_InstanceID) : uint(gl_InstanceID);
+    uint splatIndex = u_identityOrder != 0 ? instance : splatOrder[instance];
+    vec2 corner = QUAD_CORNERS[gl_VertexID];
+
+    if (u_preprocessed != 0)
+    {
+        // 间接绘制的实例都已通过剔除
+        PreprocessedSplat splat = preprocessed[splatIndex];
+        if (depthPrepass && splat.conicOpacity.w < u_depthPrepassAlpha)
+            return;
+        vec2 offset = corner.x * unpackHalf2x16(splat.axesColor.x) + corner.y * unpackHalf2x16(splat.axesColor.y);
+        vColor = depthPrepass ? vec3(0.0)
+                              : vec3(unpackHalf2x16(splat.axesColor.z), unpackHalf2x16(splat.axesColor.w).x);
+        vConicOpacity = splat.conicOpacity;
+        vDepth = splat.centerDepth.w;
+        vOffset = offset;
+        gl_Position = vec4(splat.centerDepth.xy + offset * 2.0 / u_viewport, splat.centerDepth.z, 1.0);
+        return;
+    }
+
+    vec3 position = splatPosition(splatIndex);
+    vec4 viewPos = view * vec4(position, 1.0);
+    float depth = -viewPos.z;
+    if (depth <= u_nearClip)
+        return;
+
+    vec3 cov2D = projectSplatCovariance(splatCovariance(splatIndex), viewPos.xyz, depth, view, u_focal, u_tanHalfFov);
+    float det = cov2D.x * cov2D.z - cov2D.y * cov2D.y;
+    if (det <= 0.0)
+        return;
+
+    // 面片只覆盖 α·exp(-d²/2) ≥ 1/255 的椭圆：半轴沿 2D 协方差的特征向量，长度为 k·sqrt(λ)，
+    // k 由不透明度决定（越透明越小，最大约 3.33），比固定 3σ 的轴对齐方形少画大量必然被丢弃的片元
+    float opacity = splatOpacity(splatIndex);
+    if (depthPrepass && opacity < u_depthPrepassAlpha)
+        return;
+    float sigmaCutoff = splatCutoffSigma(opacity);
+    if (sigmaCutoff <= 0.0)
+        return;
+    vec2 lambda = eigenvalues2x2(cov2D);
+    vec2 majorDir = majorAxis2x2(cov2D, lambda.x);
+    vec2 axisMajor = majorDir * (sigmaCutoff * sqrt(max(lambda.x, 0.0)));
+    vec2 axisMinor = vec2(-majorDir.y, majorDir.x) * (sigmaCutoff * sqrt(max(lambda.y, 0.0)));
+
+    vec4 clipPos = projection * viewPos;
+    vec3 ndc = clipPos.xyz / clipPos.w;
+    vec2 center = (ndc.xy * 0.5 + 0.5) * u_viewport;
+    vec2 extent = abs(axisMajor) + abs(axisMinor); // 有向面片的轴对齐包围半径
+    if (center.x + extent.x < 0.0 || center.y + extent.y < 0.0 || center.x - extent.x > u_viewport.x ||
+        center.y - extent.y > u_viewport.y)
+        return;
+
+    vec2 offset = corner.x * axisMajor + corner.y * axisMinor;
+    // 球谐 LOD 阈值沿用 3σ 半径的定义
+    float radius = ceil(3.0 * sqrt(max(lambda.x, 0.0)));
+    vColor = depthPrepass ? vec3(0.0)
+                          : evaluateSplatSH(splatIndex, normalize(position - u_viewPos), shLodDegree(radius, depth));
+    vConicOpacity = vec4(vec3(cov2D.z, -cov2D.y, cov2D.x) / det, opacity);
+    vDepth = depth;
+    vOffset = offset;
+    gl_Position = vec4(ndc.xy + offset * 2.0 / u_viewport, ndc.z, 1.0);
+}
@@ -0,0 +1,188 @@
+// 高斯点云 SSBO 访问与投影（布局与 Renderer::GaussianCloud 的 SoA 存储一致）
+// 使用方式：在 #version 之后以 #include "splat_common.glsl" 引入（由 Shader::readFile 展开）
+//
+// 整块 GaussianCloud 存储上传为一个 32 位字数组，属性 attr 的第 c 个分量、第 i 个高斯位于
+//   splatCloud[u_<attr>Offset + c * u_splatCount + i]（按位解释为 float）
+// 各属性段偏移以 32 位字为单位（存储中每段 64 字节对齐，必然整除）
+// u_splatCompressed 为 1 时缓冲内改为 CompressedGaussianCloud 的数据，下列访问函数转为反量化（splat_compressed.glsl）
+
+layout(std430, binding = 0) readonly buffer SplatCloudBuffer { uint splatCloud[]; };
+
+uniform uint u_splatCount;
+uniform uint u_positionOffset;
+uniform uint u_covarianceOffset;
+uniform uint u_opacityOffset;
+uniform uint u_shDCOffset;
+uniform uint u_shRestOffset;
+uniform uint u_shRestCoeffCount; // 每个通道的高阶系数个数：(degree + 1)^2 - 1
+uniform int u_shDegree;
+uniform int u_splatCompressed;
+// 球谐 LOD：分量 k 为降到 2 - k 阶的阈值（半径低于 / 深度超过），0 表示不使用
+uniform vec3 u_shLodRadius;
+uniform vec3 u_shLodDistance;
+
+const float SPLAT_LOW_PASS = 0.3;
+// 低于该不透明度的片元对 8 位颜色没有贡献（与 splat.fs.glsl 的丢弃阈值一致）
+const float SPLAT_ALPHA_CUTOFF = 1.0 / 255.0;
+
+// splat_preprocess.cs.glsl 写出、splat.vs.glsl 读取的逐高斯预处理结果（std430，48 字节）
+struct PreprocessedSplat
+{
+    vec4 centerDepth;  // NDC 中心 xyz + 视空间深度
+    vec4 conicOpacity; // 逆协方差 (a, b, c) + 不透明度
+    uvec4 axesColor;   // packHalf2x16：面片长轴、短轴（像素），颜色 rg、颜色 b
+};
+
+#include "splat_compressed.glsl"
+
+float splatComponent(uint offset, uint component, uint splatIndex)
+{
+    return uintBitsToFloat(splatCloud[offset + component * u_splatCount + splatIndex]);
+}
+
+vec3 splatPosition(uint splatIndex)
+{
+    if (u_splatCompressed != 0)
+        return decodeSplatPosition(splatIndex);
+    return vec3(splatComponent(u_positionOffset, 0u, splatIndex), splatComponent(u_positionOffset, 1u, splatIndex),
+                splatComponent(u_positionOffset, 2u, splatIndex));
+}
+
+// 对称 3D 协方差：xx, xy, xz, yy, yz, zz
+mat3 splatCovariance(uint splatIndex)
+{
+    if (u_splatCompressed != 0)
+        return decodeSplatCovariance(splatIndex);
+    float xx = splatComponent(u_covarianceOffset, 0u, splatIndex);
+    float xy = splatComponent(u_covarianceOffset, 1u, splatIndex);
+    float xz = splatComponent(u_covarianceOffset, 2u, splatIndex);
+    float yy = splatComponent(u_covarianceOffset, 3u, splatIndex);
+    float yz = splatComponent(u_covarianceOffset, 4u, splatIndex);
+    float zz = splatComponent(u_covarianceOffset, 5u, splatIndex);
+    return mat3(xx, xy, xz, xy, yy, yz, xz, yz, zz);
+}
+
+float splatOpacity(uint splatIndex)
+{
+    if (u_splatCompressed != 0)
+        return decodeSplatOpacity(splatIndex);
+    return splatComponent(u_opacityOffset, 0u, splatIndex);
+}
+
+// 0 阶球谐系数（RGB）
+vec3 splatSHDC(uint splatIndex)
+{
+    if (u_splatCompressed != 0)
+        return decodeSplatSH(splatIndex, 0u);
+    return vec3(splatComponent(u_shDCOffset, 0u, splatIndex), splatComponent(u_shDCOffset, 1u, splatIndex),
+                splatComponent(u_shDCOffset, 2u, splatIndex));
+}
+
+// 第 k 个高阶球谐基函数（k = 0 对应 1 阶第一项）的 RGB 系数
+vec3 splatSHRest(uint splatIndex, uint k)
+{
+    if (u_splatCompressed != 0)
+        return decodeSplatSH(splatIndex, k + 1u);
+    return vec3(splatComponent(u_shRestOffset, k, splatIndex),
+                splatComponent(u_shRestOffset, u_shRestCoeffCount + k, splatIndex),
+                splatComponent(u_shRestOffset, 2u * u_shRestCoeffCount + k, splatIndex));
+}
+
+// 按视线方向 dir（从相机指向高斯，已归一化）计算 RGB，阶数不超过 maxDegree
+vec3 evaluateSplatSH(uint splatIndex, vec3 dir, int maxDegree)
+{
+    const float C0 = 0.28209479177387814;
+    const float C1 = 0.4886025119029199;
+    const float C2[5] = float[5](1.0925484305920792, -1.0925484305920792, 0.31539156525252005,
+                                 -1.0925484305920792, 0.5462742152960396);
+    const float C3[7] = float[7](-0.5900435899266435, 2.890611442640554, -0.4570457994644658, 0.3731763325901154,
+                                 -0.4570457994644658, 1.445305721320277, -0.5900435899266435);
+
+    vec3 result = C0 * splatSHDC(splatIndex);
+    int degree = min(maxDegree, u_shDegree);
+    if (degree > 0)
+    {
+        float x = dir.x, y = dir.y, z = dir.z;
+        result += C1 * (-y * splatSHRest(splatIndex, 0u) + z * splatSHRest(splatIndex, 1u) -
+                        x * splatSHRest(splatIndex, 2u));
+        if (degree > 1)
+        {
+            float xx = x * x, yy = y * y, zz = z * z;
+            float xy = x * y, yz = y * z, xz = x * z;
+            result += C2[0] * xy * splatSHRest(splatIndex, 3u) + C2[1] * yz * splatSHRest(splatIndex, 4u) +
+                      C2[2] * (2.0 * zz - xx - yy) * splatSHRest(splatIndex, 5u) +
+                      C2[3] * xz * splatSHRest(splatIndex, 6u) + C2[4] * (xx - yy) * splatSHRest(splatIndex, 7u);
+            if (degree > 2)
+            {
+                result += C3[0] * y * (3.0 * xx - yy) * splatSHRest(splatIndex, 8u) +
+                          C3[1] * xy * z * splatSHRest(splatIndex, 9u) +
+                          C3[2] * y * (4.0 * zz - xx - yy) * splatSHRest(splatIndex, 10u) +
+                          C3[3] * z * (2.0 * zz - 3.0 * xx - 3.0 * yy) * splatSHRest(splatIndex, 11u) +
+                          C3[4] * x * (4.0 * zz - xx - yy) * splatSHRest(splatIndex, 12u) +
+                          C3[5] * z * (xx - yy) * splatSHRest(splatIndex, 13u) +
+                          C3[6] * x * (xx - 3.0 * yy) * splatSHRest(splatIndex, 14u);
+            }
+        }
+    }
+    return max(result + 0.5, vec3(0.0));
+}
+
+// 远处或屏幕上很小的高斯看不出视角相关的颜色变化，只求低阶球谐，省去高阶系数的读取与运算
+int shLodDegree(float radius, float depth)
+{
+    int degree = u_shDegree;
+    for (int k = 0; k < 3; ++k)
+    {
+        bool tooSmall = u_shLodRadius[k] > 0.0 && radius < u_shLodRadius[k];
+        bool tooFar = u_shLodDistance[k] > 0.0 && depth > u_shLodDistance[k];
+        if (tooSmall || tooFar)
+            degree = min(degree, 2 - k);
+    }
+    return degree;
+}
+
+// 与 CovarianceUtils::eigenvalues2x2 一致，cov2D = (a, b, c) 表示 [[a, b], [b, c]]，返回 (λmax, λmin)
+vec2 eigenvalues2x2(vec3 cov2D)
+{
+    float trace = cov2D.x + cov2D.z;
+    float det = cov2D.x * cov2D.z - cov2D.y * cov2D.y;
+    float sqrtDisc = sqrt(max(trace * trace - 4.0 * det, 0.0));
+    return vec2(trace + sqrtDisc, trace - sqrtDisc) * 0.5;
+}
+
+// λmax 对应的单位特征向量（λmin 对应其垂直方向）；近似各向同性时取 x 轴
+vec2 majorAxis2x2(vec3 cov2D, float lambdaMax)
+{
+    vec2 axis = vec2(cov2D.y, lambdaMax - cov2D.x);
+    float len = length(axis);
+    if (len < 1e-6 * max(lambdaMax, 1e-12))
+        return cov2D.x >= cov2D.z ? vec2(1.0, 0.0) : vec2(0.0, 1.0);
+    return axis / len;
+}
+
+// 不透明度 opacity 的高斯在马氏距离 k 处 α·exp(-k²/2) 降到 SPLAT_ALPHA_CUTOFF，返回 k（整体低于阈值时为 0）
+float splatCutoffSigma(float opacity)
+{
+    return sqrt(2.0 * max(log(opacity / SPLAT_ALPHA_CUTOFF), 0.0));
+}
+
+// EWA 投影（与 CovarianceProjector 一致）：viewPos 为视空间位置，depth = -viewPos.z > 0
+// focal / tanHalfFov 为像素焦距与半视场角正切，返回加低通滤波后的屏幕空间协方差 (a, b, c)
+vec3 projectSplatCovariance(mat3 cov3D, vec3 viewPos, float depth, mat4 viewMatrix, vec2 focal, vec2 tanHalfFov)
+{
+    float invZ = 1.0 / depth;
+    vec2 limit = 1.3 * tanHalfFov;
+    vec2 t = clamp(viewPos.xy * invZ, -limit, limit) * depth;
+
+    // 视图矩阵旋转部分的三行
+    vec3 w0 = vec3(viewMatrix[0][0], viewMatrix[1][0], viewMatrix[2][0]);
+    vec3 w1 = vec3(viewMatrix[0][1], viewMatrix[1][1], viewMatrix[2][1]);
+    vec3 w2 = vec3(viewMatrix[0][2], viewMatrix[1][2], viewMatrix[2][2]);
+
+    // T = J·W 的两行
+    vec3 t0 = focal.x * invZ * w0 + focal.x * t.x * invZ * invZ * w2;
+    vec3 t1 = focal.y * invZ * w1 + focal.y * t.y * invZ * invZ * w2;
+    vec3 s0 = cov3D * t0;
+    vec3 s1 = cov3D * t1;
+    return vec3(dot(t0, s0) + SPLAT_LOW_PASS, dot(t1, s0), dot(t1, s1) + SPLAT_LOW_PASS);
+}
@@ -0,0 +1,108 @@
+// 量化高斯点云解码（布局与 Renderer::CompressedGaussianCloud 一致）
+// 由 splat_common.glsl 引入，u_splatCompressed 为 1 时 splatCloud 缓冲内依次拼接（偏移以 32 位字为单位）：
+//   [0, 4 * u_splatCount) 每个高斯 4 个字 | u_chunkOffset 起块量化范围（float）
+//   | u_shOffset 起球谐数据 | u_shCodebookOffset 起可选的高阶球谐码本（SHCodebook，float）
+
+const uint SPLAT_CHUNK_SIZE = 256u;
+const uint SPLAT_CHUNK_FLOATS = 16u;
+const int SH_ENCODING_FLOAT16 = 0;
+const int SH_ENCODING_UINT8 = 1;
+
+uniform uint u_chunkOffset;
+uniform uint u_shOffset;
+uniform uint u_shWordsPerSplat;
+uniform int u_shEncoding;
+uniform uint u_shCodebookOffset;
+uniform int u_shCodebookDim; // 码字 float 个数，0 表示未使用码本；码字内顺序为 (k - 1) * 3 + channel
+
+uvec4 compressedSplatWords(uint splatIndex)
+{
+    uint base = splatIndex * 4u;
+    return uvec4(splatCloud[base], splatCloud[base + 1u], splatCloud[base + 2u], splatCloud[base + 3u]);
+}
+
+float splatChunkValue(uint splatIndex, uint offset)
+{
+    return uintBitsToFloat(splatCloud[u_chunkOffset + (splatIndex / SPLAT_CHUNK_SIZE) * SPLAT_CHUNK_FLOATS + offset]);
+}
+
+vec3 decodeSplatPosition(uint splatIndex)
+{
+    uvec4 words = compressedSplatWords(splatIndex);
+    vec3 t = vec3(float(words.x & 0xffffu), float(words.x >> 16), float(words.y & 0xffffu)) / 65535.0;
+    vec3 minPos = vec3(splatChunkValue(splatIndex, 0u), splatChunkValue(splatIndex, 1u), splatChunkValue(splatIndex, 2u));
+    vec3 maxPos = vec3(splatChunkValue(splatIndex, 3u), splatChunkValue(splatIndex, 4u), splatChunkValue(splatIndex, 5u));
+    return mix(minPos, maxPos, t);
+}
+
+// 返回 (x, y, z, w)，与 CovarianceUtils 的四元数约定一致
+vec4 decodeSplatRotation(uint splatIndex)
+{
+    uint packed = splatCloud[splatIndex * 4u + 2u];
+    uint largest = packed >> 30;
+    vec3 others = (vec3(packed & 1023u, (packed >> 10) & 1023u, (packed >> 20) & 1023u) / 1023.0 - 0.5) * 1.41421356;
+    float w = sqrt(max(0.0, 1.0 - dot(others, others)));
+    if (largest == 0u) return vec4(w, others.x, others.y, others.z);
+    if (largest == 1u) return vec4(others.x, w, others.y, others.z);
+    if (largest == 2u) return vec4(others.x, others.y, w, others.z);
+    return vec4(others.x, others.y, others.z, w);
+}
+
+vec3 decodeSplatScale(uint splatIndex)
+{
+    vec4 codes = unpackUnorm4x8(splatCloud[splatIndex * 4u + 3u]);
+    vec3 minLog = vec3(splatChunkValue(splatIndex, 6u), splatChunkValue(splatIndex, 7u), splatChunkValue(splatIndex, 8u));
+    vec3 maxLog = vec3(splatChunkValue(splatIndex, 9u), splatChunkValue(splatIndex, 10u), splatChunkValue(splatIndex, 11u));
+    return exp(mix(minLog, maxLog, codes.xyz));
+}
+
+float decodeSplatOpacity(uint splatIndex)
+{
+    return unpackUnorm4x8(splatCloud[splatIndex * 4u + 3u]).w;
+}
+
+// Σ = R·S·Sᵀ·Rᵀ，与 CovarianceUtils::compute3DCovarianceBatch 一致
+mat3 decodeSplatCovariance(uint splatIndex)
+{
+    vec4 q = decodeSplatRotation(splatIndex);
+    vec3 s = decodeSplatScale(splatIndex);
+    float xx = q.x * q.x, yy = q.y * q.y, zz = q.z * q.z;
+    float xy = q.x * q.y, xz = q.x * q.z, yz = q.y * q.z;
+    float wx = q.w * q.x, wy = q.w * q.y, wz = q.w * q.z;
+    mat3 rotation = mat3(1.0 - 2.0 * (yy + zz), 2.0 * (xy + wz), 2.0 * (xz - wy),
+                         2.0 * (xy - wz), 1.0 - 2.0 * (xx + zz), 2.0 * (yz + wx),
+                         2.0 * (xz + wy), 2.0 * (yz - wx), 1.0 - 2.0 * (xx + yy));
+    mat3 m = rotation * mat3(s.x, 0.0, 0.0, 0.0, s.y, 0.0, 0.0, 0.0, s.z);
+    return m * transpose(m);
+}
+
+// 第 k 个球谐基函数的 RGB 系数（k = 0 为 DC）
+vec3 decodeSplatSH(uint splatIndex, uint k)
+{
+    if (k > 0u && u_shCodebookDim > 0)
+    {
+        uint entry = splatCloud[splatIndex * 4u + 1u] >> 16;
+        uint offset = u_shCodebookOffset + entry * uint(u_shCodebookDim) + (k - 1u) * 3u;
+        return vec3(uintBitsToFloat(splatCloud[offset]), uintBitsToFloat(splatCloud[offset + 1u]),
+                    uintBitsToFloat(splatCloud[offset + 2u]));
+    }
+
+    uint base = u_shOffset + splatIndex * u_shWordsPerSplat;
+    vec3 result;
+    for (uint channel = 0u; channel < 3u; ++channel)
+    {
+        uint j = k * 3u + channel;
+        if (u_shEncoding == SH_ENCODING_UINT8)
+        {
+            float t = float((splatCloud[base + j / 4u] >> ((j % 4u) * 8u)) & 0xffu) / 255.0;
+            uint rangeOffset = k == 0u ? 12u : 14u;
+            result[channel] = mix(splatChunkValue(splatIndex, rangeOffset), splatChunkValue(splatIndex, rangeOffset + 1u), t);
+        }
+        else
+        {
+            vec2 pair = unpackHalf2x16(splatCloud[base + j / 2u]);
+            result[channel] = (j % 2u) == 0u ? pair.x : pair.y;
+        }
+    }
+    return result;
+}
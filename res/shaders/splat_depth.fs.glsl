@@ -0,0 +1,19 @@
+#version 430 core
+
+// 高斯深度预通道：只在 α 不低于阈值（近乎不透明）的片元写入深度，不输出颜色
+flat in vec4 vConicOpacity;
+in vec2 vOffset;
+
+uniform float u_depthPrepassAlpha;
+
+void main()
+{
+    vec2 d = vOffset;
+    float power = -0.5 * (vConicOpacity.x * d.x * d.x + vConicOpacity.z * d.y * d.y) - vConicOpacity.y * d.x * d.y;
+    if (power > 0.0)
+        discard;
+
+    float alpha = min(0.99, vConicOpacity.w * exp(power));
+    if (alpha < u_depthPrepassAlpha)
+        discard;
+}
@@ -0,0 +1,37 @@
+#version 430 core
+
+// 加权混合顺序无关透明（McGuire & Bavoil 2013）：无需排序，近似结果
+// accum 以 (ONE, ONE) 累加 w·(预乘颜色, α)，revealage 以 (ZERO, ONE_MINUS_SRC_COLOR) 累乘 (1 - α)
+
+layout(early_fragment_tests) in;
+
+flat in vec3 vColor;
+flat in vec4 vConicOpacity;
+flat in float vDepth; // 视空间深度
+in vec2 vOffset;
+
+layout(location = 0) out vec4 AccumColor;
+layout(location = 1) out float Revealage;
+
+// 深度权重（论文式 (7)）：近处的高斯在累加中占主导
+float oitWeight(float depth, float alpha)
+{
+    float w = 10.0 / (1e-5 + pow(depth / 5.0, 2.0) + pow(depth / 200.0, 6.0));
+    return alpha * clamp(w, 1e-2, 3e3);
+}
+
+void main()
+{
+    vec2 d = vOffset;
+    float power = -0.5 * (vConicOpacity.x * d.x * d.x + vConicOpacity.z * d.y * d.y) - vConicOpacity.y * d.x * d.y;
+    if (power > 0.0)
+        discard;
+
+    float alpha = min(0.99, vConicOpacity.w * exp(power));
+    if (alpha < 1.0 / 255.0)
+        discard;
+
+    float w = oitWeight(vDepth, alpha);
+    AccumColor = vec4(vColor * alpha, alpha) * w;
+    Revealage = alpha;
+}
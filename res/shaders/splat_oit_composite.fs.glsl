@@ -0,0 +1,18 @@
+#version 430 core
+
+// 把加权混合 OIT 的累加结果合成到场景颜色上：C = avg · (1 - revealage) + scene · revealage
+in vec2 texCoord;
+out vec4 FragColor;
+
+uniform sampler2D u_sceneTexture;
+uniform sampler2D u_accumTexture;
+uniform sampler2D u_revealageTexture;
+
+void main()
+{
+    vec4 scene = texture(u_sceneTexture, texCoord);
+    float revealage = texture(u_revealageTexture, texCoord).r;
+    vec4 accum = texture(u_accumTexture, texCoord);
+    vec3 average = accum.rgb / max(accum.a, 1e-5);
+    FragColor = vec4(average * (1.0 - revealage) + scene.rgb * revealage, scene.a);
+}
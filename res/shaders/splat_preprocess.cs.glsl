@@ -0,0 +1,111 @@
+#version 430 core
+#include "splat_common.glsl"
+#include "splat_sort_common.glsl"
+
+// 逐高斯预处理（每个线程一个高斯）：视图变换、剔除、EWA 投影、有向面片半轴与球谐颜色，
+// 结果按高斯下标写入记录缓冲，绘制时顶点着色器直接读取。
+// 可见高斯先在组内压缩、再以一次全局原子加法取得写入位置，写入紧凑的可见列表，
+// 全局计数即间接绘制命令的 instanceCount（调用方每帧先将其清零）
+layout(local_size_x = 256) in;
+
+// 绑定点：0 点云（splat_common.glsl），2 预处理记录，3 可见列表，4 DrawArraysIndirectCommand，5/6 排序键/下标
+layout(std430, binding = 2) writeonly buffer PreprocessedBuffer { PreprocessedSplat preprocessed[]; };
+layout(std430, binding = 3) writeonly buffer VisibleBuffer { uint visibleList[]; };
+layout(std430, binding = 4) buffer DrawCommandBuffer
+{
+    uint drawVertexCount;
+    uint drawInstanceCount;
+    uint drawFirst;
+    uint drawBaseInstance;
+};
+layout(std430, binding = 5) writeonly buffer SortKeyBuffer { uint sortKeys[]; };
+layout(std430, binding = 6) writeonly buffer SortIndexBuffer { uint sortIndices[]; };
+
+uniform mat4 view;
+uniform mat4 projection;
+uniform vec3 u_viewPos;
+uniform vec2 u_viewport;
+uniform vec2 u_focal;
+uniform vec2 u_tanHalfFov;
+uniform float u_nearClip;
+uniform float u_minOpacity; // 与 SplatCuller 相同的剔除阈值，0 表示不剔除
+uniform float u_minRadius;  // 3σ 屏幕半径（未加低通，像素）
+// 为 1 时同时写出 GpuSplatSorter 的深度键与初始下标，被剔除的高斯键为最大值，排序后位于末尾
+uniform int u_writeSortKeys;
+
+shared uint s_visibleCount;
+shared uint s_visibleBase;
+
+// 与 splat.vs.glsl 的逐实例计算一致，返回是否可见
+bool preprocessSplat(uint splatIndex, out PreprocessedSplat record, out float depth)
+{
+    vec3 position = splatPosition(splatIndex);
+    vec4 viewPos = view * vec4(position, 1.0);
+    depth = -viewPos.z;
+    float opacity = splatOpacity(splatIndex);
+    if (depth <= u_nearClip || opacity < u_minOpacity)
+        return false;
+    float sigmaCutoff = splatCutoffSigma(opacity);
+    if (sigmaCutoff <= 0.0)
+        return false;
+
+    vec3 cov2D = projectSplatCovariance(splatCovariance(splatIndex), viewPos.xyz, depth, view, u_focal, u_tanHalfFov);
+    float det = cov2D.x * cov2D.z - cov2D.y * cov2D.y;
+    if (det <= 0.0)
+        return false;
+    vec2 lambda = eigenvalues2x2(cov2D);
+    if (u_minRadius > 0.0 && 3.0 * sqrt(max(lambda.x - SPLAT_LOW_PASS, 0.0)) < u_minRadius)
+        return false;
+
+    vec2 majorDir = majorAxis2x2(cov2D, lambda.x);
+    vec2 axisMajor = majorDir * (sigmaCutoff * sqrt(max(lambda.x, 0.0)));
+    vec2 axisMinor = vec2(-majorDir.y, majorDir.x) * (sigmaCutoff * sqrt(max(lambda.y, 0.0)));
+
+    vec4 clipPos = projection * viewPos;
+    vec3 ndc = clipPos.xyz / clipPos.w;
+    vec2 center = (ndc.xy * 0.5 + 0.5) * u_viewport;
+    vec2 extent = abs(axisMajor) + abs(axisMinor);
+    if (center.x + extent.x < 0.0 || center.y + extent.y < 0.0 || center.x - extent.x > u_viewport.x ||
+        center.y - extent.y > u_viewport.y)
+        return false;
+
+    float radius = ceil(3.0 * sqrt(max(lambda.x, 0.0)));
+    vec3 color = evaluateSplatSH(splatIndex, normalize(position - u_viewPos), shLodDegree(radius, depth));
+    record.centerDepth = vec4(ndc, depth);
+    record.conicOpacity = vec4(vec3(cov2D.z, -cov2D.y, cov2D.x) / det, opacity);
+    record.axesColor = uvec4(packHalf2x16(axisMajor), packHalf2x16(axisMinor), packHalf2x16(color.rg),
+                             packHalf2x16(vec2(color.b, 0.0)));
+    return true;
+}
+
+void main()
+{
+    uint lid = gl_LocalInvocationID.x;
+    // 大点云以二维网格派发（见 GpuSplatPreprocessor::Run）
+    uint splatIndex = (gl_WorkGroupID.y * gl_NumWorkGroups.x + gl_WorkGroupID.x) * gl_WorkGroupSize.x + lid;
+    if (lid == 0u)
+        s_visibleCount = 0u;
+    barrier();
+
+    // 越界线程也要走到各个 barrier，只是不可见
+    PreprocessedSplat record;
+    float depth = 0.0;
+    bool visible = splatIndex < u_splatCount && preprocessSplat(splatIndex, record, depth);
+    uint localSlot = visible ? atomicAdd(s_visibleCount, 1u) : 0u;
+    barrier();
+
+    if (lid == 0u)
+        s_visibleBase = atomicAdd(drawInstanceCount, s_visibleCount);
+    barrier();
+
+    if (visible)
+    {
+        preprocessed[splatIndex] = record;
+        visibleList[s_visibleBase + localSlot] = splatIndex;
+    }
+    if (u_writeSortKeys != 0 && splatIndex < u_splatCount)
+    {
+        sortKeys[splatIndex] = visible ? ~floatToKey(depth) : 0xffffffffu;
+        sortIndices[splatIndex] = splatIndex;
+    }
+}
@@ -0,0 +1,20 @@
+// GPU 高斯深度排序公共定义（与 Renderer::GpuSplatSorter 保持一致）
+// 每个工作组处理 SORT_TILE_SIZE 个元素，各趟使用相同的分块以保证散射结果稳定
+
+#define SORT_WORKGROUP_SIZE 256u
+#define SORT_ITEMS_PER_THREAD 16u
+#define SORT_TILE_SIZE (SORT_WORKGROUP_SIZE * SORT_ITEMS_PER_THREAD)
+#define SORT_RADIX 256u
+#define SORT_MASK_WORDS (SORT_WORKGROUP_SIZE / 32u)
+
+// 绑定点：0 位置平面 x|y|z，1/2 输入键/下标，3/4 输出键/下标，5 每组直方图（桶优先），6 桶起点
+uniform uint u_count;
+uniform uint u_workgroupCount;
+
+// 浮点数按位映射为保序的无符号键
+uint floatToKey(float value)
+{
+    uint bits = floatBitsToUint(value);
+    uint mask = (bits & 0x80000000u) != 0u ? 0xffffffffu : 0x80000000u;
+    return bits ^ mask;
+}
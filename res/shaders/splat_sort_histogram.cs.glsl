@@ -0,0 +1,30 @@
+#version 430 core
+#include "splat_sort_common.glsl"
+
+// 统计本组分块内当前 8 位数字的直方图，按 [bucket][workgroup] 写出以便逐桶前缀和
+layout(local_size_x = 256) in;
+
+layout(std430, binding = 1) readonly buffer KeyInBuffer { uint keysIn[]; };
+layout(std430, binding = 5) writeonly buffer HistogramBuffer { uint histograms[]; };
+
+uniform uint u_shift;
+
+shared uint s_histogram[SORT_RADIX];
+
+void main()
+{
+    uint lid = gl_LocalInvocationID.x;
+    s_histogram[lid] = 0u;
+    barrier();
+
+    uint tileBegin = gl_WorkGroupID.x * SORT_TILE_SIZE;
+    for (uint item = 0u; item < SORT_ITEMS_PER_THREAD; ++item)
+    {
+        uint index = tileBegin + item * SORT_WORKGROUP_SIZE + lid;
+        if (index < u_count)
+            atomicAdd(s_histogram[(keysIn[index] >> u_shift) & (SORT_RADIX - 1u)], 1u);
+    }
+    barrier();
+
+    histograms[lid * u_workgroupCount + gl_WorkGroupID.x] = s_histogram[lid];
+}
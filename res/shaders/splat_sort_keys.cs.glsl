@@ -0,0 +1,26 @@
+#version 430 core
+#include "splat_sort_common.glsl"
+
+// 深度键生成：深度越大键越小，升序排序即为从后往前的混合顺序
+layout(local_size_x = 256) in;
+
+layout(std430, binding = 0) readonly buffer PositionBuffer { float positions[]; };
+layout(std430, binding = 3) writeonly buffer KeyOutBuffer { uint keysOut[]; };
+layout(std430, binding = 4) writeonly buffer ValueOutBuffer { uint valuesOut[]; };
+
+uniform vec4 u_viewRow; // 视图矩阵第 3 行，视空间深度 = -dot(u_viewRow, vec4(p, 1))
+
+void main()
+{
+    uint tileBegin = gl_WorkGroupID.x * SORT_TILE_SIZE;
+    for (uint item = 0u; item < SORT_ITEMS_PER_THREAD; ++item)
+    {
+        uint index = tileBegin + item * SORT_WORKGROUP_SIZE + gl_LocalInvocationID.x;
+        if (index >= u_count)
+            return;
+        vec3 p = vec3(positions[index], positions[u_count + index], positions[2u * u_count + index]);
+        float depth = -dot(u_viewRow, vec4(p, 1.0));
+        keysOut[index] = ~floatToKey(depth);
+        valuesOut[index] = index;
+    }
+}
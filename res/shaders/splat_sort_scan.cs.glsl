@@ -0,0 +1,56 @@
+#version 430 core
+#include "splat_sort_common.glsl"
+
+// 前缀和，分两级：
+// u_stage = 0：每个工作组负责一个桶，对该桶在所有分块上的计数做排他前缀和，桶总数写入 bucketOffsets
+// u_stage = 1：单个工作组对 256 个桶总数做排他前缀和，得到每个桶的全局起点
+layout(local_size_x = 256) in;
+
+layout(std430, binding = 5) buffer HistogramBuffer { uint histograms[]; };
+layout(std430, binding = 6) buffer BucketOffsetBuffer { uint bucketOffsets[]; };
+
+uniform uint u_stage;
+
+shared uint s_scan[SORT_WORKGROUP_SIZE];
+
+// 工作组内包含式前缀和（Hillis-Steele），结果留在 s_scan
+void inclusiveScan(uint value)
+{
+    uint lid = gl_LocalInvocationID.x;
+    s_scan[lid] = value;
+    barrier();
+    for (uint offset = 1u; offset < SORT_WORKGROUP_SIZE; offset <<= 1u)
+    {
+        uint addend = lid >= offset ? s_scan[lid - offset] : 0u;
+        barrier();
+        s_scan[lid] += addend;
+        barrier();
+    }
+}
+
+void main()
+{
+    uint lid = gl_LocalInvocationID.x;
+    if (u_stage == 1u)
+    {
+        uint total = bucketOffsets[lid];
+        inclusiveScan(total);
+        bucketOffsets[lid] = s_scan[lid] - total;
+        return;
+    }
+
+    uint base = gl_WorkGroupID.x * u_workgroupCount;
+    uint carry = 0u;
+    for (uint chunk = 0u; chunk < u_workgroupCount; chunk += SORT_WORKGROUP_SIZE)
+    {
+        uint index = chunk + lid;
+        uint value = index < u_workgroupCount ? histograms[base + index] : 0u;
+        inclusiveScan(value);
+        if (index < u_workgroupCount)
+            histograms[base + index] = carry + s_scan[lid] - value;
+        carry += s_scan[SORT_WORKGROUP_SIZE - 1u];
+        barrier();
+    }
+    if (lid == 0u)
+        bucketOffsets[gl_WorkGroupID.x] = carry;
+}
@@ -0,0 +1,65 @@
+#version 430 core
+#include "splat_sort_common.glsl"
+
+// 稳定散射：每轮 256 个元素，用每个数字的位掩码统计组内排在自己之前的同数字元素个数作为局部名次
+layout(local_size_x = 256) in;
+
+layout(std430, binding = 1) readonly buffer KeyInBuffer { uint keysIn[]; };
+layout(std430, binding = 2) readonly buffer ValueInBuffer { uint valuesIn[]; };
+layout(std430, binding = 3) writeonly buffer KeyOutBuffer { uint keysOut[]; };
+layout(std430, binding = 4) writeonly buffer ValueOutBuffer { uint valuesOut[]; };
+layout(std430, binding = 5) readonly buffer HistogramBuffer { uint histograms[]; };
+layout(std430, binding = 6) readonly buffer BucketOffsetBuffer { uint bucketOffsets[]; };
+
+uniform uint u_shift;
+
+shared uint s_masks[SORT_RADIX * SORT_MASK_WORDS];
+shared uint s_offsets[SORT_RADIX];
+
+void main()
+{
+    uint lid = gl_LocalInvocationID.x;
+    uint word = lid / 32u;
+    uint lowerBits = (1u << (lid % 32u)) - 1u;
+
+    // 本组每个数字的写入起点 = 桶全局起点 + 前面各组在该桶中的计数
+    s_offsets[lid] = bucketOffsets[lid] + histograms[lid * u_workgroupCount + gl_WorkGroupID.x];
+
+    uint tileBegin = gl_WorkGroupID.x * SORT_TILE_SIZE;
+    for (uint item = 0u; item < SORT_ITEMS_PER_THREAD; ++item)
+    {
+        for (uint w = 0u; w < SORT_MASK_WORDS; ++w)
+            s_masks[lid * SORT_MASK_WORDS + w] = 0u;
+        barrier();
+
+        uint index = tileBegin + item * SORT_WORKGROUP_SIZE + lid;
+        bool valid = index < u_count;
+        uint key = 0u;
+        uint digit = 0u;
+        if (valid)
+        {
+            key = keysIn[index];
+            digit = (key >> u_shift) & (SORT_RADIX - 1u);
+            atomicOr(s_masks[digit * SORT_MASK_WORDS + word], 1u << (lid % 32u));
+        }
+        barrier();
+
+        if (valid)
+        {
+            uint rank = uint(bitCount(s_masks[digit * SORT_MASK_WORDS + word] & lowerBits));
+            for (uint w = 0u; w < word; ++w)
+                rank += uint(bitCount(s_masks[digit * SORT_MASK_WORDS + w]));
+            uint dst = s_offsets[digit] + rank;
+            keysOut[dst] = key;
+            valuesOut[dst] = valuesIn[index];
+        }
+        barrier();
+
+        // 线程 lid 负责推进数字 lid 的写入位置
+        uint total = 0u;
+        for (uint w = 0u; w < SORT_MASK_WORDS; ++w)
+            total += uint(bitCount(s_masks[lid * SORT_MASK_WORDS + w]));
+        s_offsets[lid] += total;
+        barrier();
+    }
+}
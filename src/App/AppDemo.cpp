@@ -2,6 +2,7 @@
 #include "Assets/MaterialManager.h"
 #include "Logger/Log.h"
 #include "ModelLoader/AssimpModelLoader.h"
+#include "ModelLoader/GaussianCloudLoader.h"
 #include "Renderer/Light.h"
 #include "Renderer/MathUtils/Random.h"
 #include "Renderer/Primitives/CubePrimitive.h"
@@ -12,7 +13,9 @@
 #include "Renderer/Effects/BloomEffect.h"
 #include "Renderer/Renderable.h"
 #include "Renderer/ShaderManager.h"
+#include "Renderer/SplatPass.h"
 #include <memory>
+#include <string>
 
 #if defined(GSENGINE_OS_WINDOWS) || defined(_WIN32)
 #include <windows.h>
@@ -33,7 +36,8 @@ std::string OpenModelFileDialog()
     char buf[1024] = {};
     ofn.lStructSize = sizeof(ofn);
     ofn.lpstrFilter =
-        "Model files (*.glb;*.gltf;*.fbx;*.obj)\0*.glb;*.gltf;*.fbx;*.obj\0All (*.*)\0*.*\0";
+        "Model files (*.glb;*.gltf;*.fbx;*.obj)\0*.glb;*.gltf;*.fbx;*.obj\0"
+        "Gaussian splats (*.ply;*.gsc)\0*.ply;*.gsc\0All (*.*)\0*.*\0";
     ofn.lpstrFile = buf;
     ofn.nMaxFile = sizeof(buf);
     ofn.Flags = OFN_FILEMUSTEXIST | OFN_PATHMUSTEXIST;
@@ -53,6 +57,18 @@ std::string OpenModelFileDialog()
 }
 #endif
 
+namespace
+{
+bool IsGaussianCloudFile(const std::string &path)
+{
+    const size_t dot = path.find_last_of('.');
+    if (dot == std::string::npos)
+        return false;
+    const std::string ext = path.substr(dot);
+    return ext == ".ply" || ext == ".gsc";
+}
+}
+
 #ifdef RENDERER_DEBUG
 std::string modelPath = "./res/backpack/backpack.obj";
 std::string model2Path = "./res/houtou.fbx";
@@ -83,6 +99,7 @@ public:
     int currentSelectedUID = -1;
     std::shared_ptr<Renderer::Renderable> selectedRenderable = nullptr;
     float currentTime = 0.0f;
+    int splatCaptureCount = 0; // 已保存的 SplatPass 读回数，用于生成文件名
 };
 
 AppDemo::AppDemo(AppConfig config) : Application(config), pImpl(std::make_unique<Impl>())
@@ -184,6 +201,20 @@ void AppDemo::OnUpdate(float deltaTime)
         pImpl->pointLights[i]->color = pImpl->pointLightSphereRenderables[i]->getColor();
     }
 
+    // 保存上一帧 F12 请求的 SplatPass 读回，可用 SplatRenderTool 以同一视图渲染并对比
+    if (auto *splatPass = dynamic_cast<Renderer::SplatPass *>(m_renderPipeline->GetPass("SplatPass")))
+    {
+        Renderer::SplatImage capture;
+        if (splatPass->TakeCapture(capture))
+        {
+            std::string path = "splat_capture_" + std::to_string(pImpl->splatCaptureCount++) + ".spim";
+            if (capture.Save(path))
+                LOG_INFO("保存高斯读回: {} ({}x{})", path, capture.width, capture.height);
+            else
+                LOG_ERROR("Failed to save splat capture: {}", path);
+        }
+    }
+
     // 处理拾取（通过 RenderPipeline 的接口）—— 场景点击也通过 GuiLayer 更新选中状态
     if (m_inputState.pickRequested)
     {
@@ -246,6 +277,11 @@ void AppDemo::OnLoadModelRequested()
     std::string path = OpenModelFileDialog();
     if (path.empty())
         return;
+    if (IsGaussianCloudFile(path))
+    {
+        LoadGaussianCloud(path);
+        return;
+    }
     AssimpModelLoader loader(*m_textureManager, *m_materialManager);
     std::shared_ptr<Renderer::Model> model = loader.loadModel(path);
     if (!model)
@@ -260,6 +296,36 @@ void AppDemo::OnLoadModelRequested()
     LOG_INFO("Loaded model: {}", path);
 }
 
+void AppDemo::LoadGaussianCloud(const std::string &path)
+{
+    const Renderer::RenderPipelineConfig &config = m_renderPipeline->GetConfig();
+    GaussianCloudLoader loader;
+    loader.setMaxSHDegree(config.splatMaxSHDegree);
+    loader.setMemoryBudget(config.splatMemoryBudget);
+    // 码本只在压缩上传时使用
+    if (config.splatCompressed)
+        loader.setSHCodebookEntries(config.splatSHCodebookEntries);
+    std::shared_ptr<Renderer::GaussianCloud> cloud = loader.loadCloud(path);
+    if (!cloud)
+    {
+        LOG_ERROR("Failed to load gaussian cloud: {}", path);
+        return;
+    }
+
+    // 首次加载时在光照之后插入 SplatPass，高斯与前向物体一起进入后处理链
+    auto *splatPass = dynamic_cast<Renderer::SplatPass *>(m_renderPipeline->GetPass("SplatPass"));
+    if (!splatPass)
+    {
+        auto pass = std::make_unique<Renderer::SplatPass>(*m_shaderManager, config);
+        splatPass = pass.get();
+        if (m_inputState.togglePoints)
+            splatPass->SetPointPreview(true);
+        m_renderPipeline->InsertPassAfter("LightingPass", std::move(pass));
+    }
+    splatPass->SetCloud(cloud, loader.getSHCodebook());
+    LOG_INFO("Loaded gaussian cloud: {} ({} splats, SH{})", path, cloud->GetCount(), cloud->GetSHDegree());
+}
+
 void AppDemo::HandleKeyEvent(int key, int scancode, int action, int mods)
 {
     // 调用基类处理
@@ -269,7 +335,26 @@ void AppDemo::HandleKeyEvent(int key, int scancode, int action, int mods)
     if (key == static_cast<int>(Key::P) && action == ACTION_PRESS)
     {
         m_inputState.togglePoints = !m_inputState.togglePoints;
-        LOG_INFO("切换点云渲染模式: {}", m_inputState.togglePoints ? "Points" : "Splats");
+        auto *splatPass = dynamic_cast<Renderer::SplatPass *>(m_renderPipeline->GetPass("SplatPass"));
+        if (splatPass)
+            splatPass->SetPointPreview(m_inputState.togglePoints);
+        LOG_INFO("切换点云预览（相机移动时画点）: {}", m_inputState.togglePoints ? "On" : "Off");
+    }
+    if (key == static_cast<int>(Key::O) && action == ACTION_PRESS)
+    {
+        auto *splatPass = dynamic_cast<Renderer::SplatPass *>(m_renderPipeline->GetPass("SplatPass"));
+        if (splatPass)
+        {
+            const bool sorted = splatPass->GetBlendMode() == Renderer::SplatBlendMode::Sorted;
+            splatPass->SetBlendMode(sorted ? Renderer::SplatBlendMode::WeightedOIT : Renderer::SplatBlendMode::Sorted);
+            LOG_INFO("切换高斯混合方式: {}", sorted ? "Weighted OIT" : "Sorted");
+        }
+    }
+    if (key == static_cast<int>(Key::F12) && action == ACTION_PRESS)
+    {
+        auto *splatPass = dynamic_cast<Renderer::SplatPass *>(m_renderPipeline->GetPass("SplatPass"));
+        if (splatPass)
+            splatPass->RequestCapture();
     }
 }
 
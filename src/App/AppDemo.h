@@ -7,6 +7,7 @@
 #include "Renderer/Material.h"
 #include "Renderer/Model.h"
 #include <memory>
+#include <string>
 
 class AppDemo : public GSEngine::Application
 {
@@ -27,6 +28,8 @@ public:
 private:
     /// 由 UI “加载模型” 按钮触发：打开文件对话框并加载选中模型到场景
     void OnLoadModelRequested();
+    /// 加载 3DGS 点云（.ply / .gsc），首次加载时向渲染管线插入 SplatPass
+    void LoadGaussianCloud(const std::string &path);
     // 场景设置
     void SetupScene(
         std::shared_ptr<Renderer::CubePrimitive> cubePrimitive,
@@ -0,0 +1,176 @@
+// 高斯深度排序基准：多线程 LSD 基数排序 vs std::sort，以及环绕相机下的增量排序 vs 逐帧完整排序
+// 构建：cmake -DBUILD_BENCHMARKS=ON，运行 bin/SplatSortBenchmark [重复次数]
+#include "Core/ThreadPool.h"
+#include "Splat/RadixSort.h"
+#include "Splat/SplatSorter.h"
+#include <cmath>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace Renderer;
+
+namespace
+{
+double ElapsedMs(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// 模拟一帧的视空间深度：相机前方 0.1 ~ 100 的随机分布
+void GenerateKeys(size_t count, unsigned int seed, std::vector<uint32_t> &keys, std::vector<uint32_t> &values)
+{
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> depth(0.1f, 100.0f);
+    keys.resize(count);
+    values.resize(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        keys[i] = RadixSorter::DepthToBackToFrontKey(depth(rng));
+        values[i] = static_cast<uint32_t>(i);
+    }
+}
+
+// 绕 Y 轴环绕原点的相机视图矩阵（列主序），相机距原点 radius
+void OrbitView(float angle, float radius, float *view)
+{
+    const float c = std::cos(angle), s = std::sin(angle);
+    // 相机位于 (radius*s, 0, radius*c) 看向原点：右 = (c,0,-s)，上 = (0,1,0)，后 = (s,0,c)
+    const float m[16] = {c, 0.0f, s, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, -s, 0.0f, c, 0.0f, 0.0f, 0.0f, -radius, 1.0f};
+    std::copy(m, m + 16, view);
+}
+
+// 模拟轨道导航：每帧旋转一个小角度，比较增量排序与逐帧完整排序的平均耗时
+int RunOrbitBenchmark(size_t count, int frames, float degreesPerFrame)
+{
+    std::mt19937 rng(4321);
+    std::uniform_real_distribution<float> coord(-10.0f, 10.0f);
+    std::vector<float> planes[3];
+    for (auto &plane : planes)
+    {
+        plane.resize(count);
+        for (float &v : plane)
+            v = coord(rng);
+    }
+    const float *position[3] = {planes[0].data(), planes[1].data(), planes[2].data()};
+
+    SplatSorter fullSorter;
+    fullSorter.SetMode(SplatSorter::Mode::Full);
+    SplatSorter incrementalSorter;
+
+    float view[16];
+    double fullMs = 0.0, incrementalMs = 0.0;
+    int incrementalFrames = 0;
+    int skippedFrames = 0;
+    double disorder = 0.0;
+    for (int frame = 0; frame <= frames; ++frame)
+    {
+        OrbitView(frame * degreesPerFrame * 3.14159265f / 180.0f, 30.0f, view);
+        fullSorter.Sort(position, count, view);
+        incrementalSorter.Sort(position, count, view);
+        // 第 0 帧没有历史排列，不计入统计
+        if (frame == 0)
+            continue;
+        fullMs += fullSorter.GetStats().milliseconds;
+        incrementalMs += incrementalSorter.GetStats().milliseconds;
+        incrementalFrames += incrementalSorter.GetStats().fullSort ? 0 : 1;
+        skippedFrames += incrementalSorter.GetStats().skipped ? 1 : 0;
+        disorder += incrementalSorter.GetStats().disorder;
+
+        // 校验：增量结果的深度从远到近单调，允许一个量化区间内的逆序
+        const std::vector<uint32_t> &order = incrementalSorter.GetOrder();
+        std::vector<float> depths(count);
+        for (size_t j = 0; j < count; ++j)
+        {
+            const uint32_t i = order[j];
+            depths[j] = -(view[2] * position[0][i] + view[6] * position[1][i] + view[10] * position[2][i] + view[14]);
+        }
+        const auto range = std::minmax_element(depths.begin(), depths.end());
+        const float tolerance =
+            (*range.second - *range.first) / static_cast<float>((1ull << incrementalSorter.GetKeyBits()) - 1) * 1.01f;
+        float nearest = depths[0];
+        for (size_t j = 1; j < count; ++j)
+        {
+            if (depths[j] > nearest + tolerance)
+            {
+                std::printf("ORDER ERROR at frame %d\n", frame);
+                return 1;
+            }
+            nearest = std::min(nearest, depths[j]);
+        }
+    }
+
+    fullMs /= frames;
+    incrementalMs /= frames;
+    std::printf("%10zu %9.4f %9.3f %10.2f %15.2f %8.2fx %6d/%d %8d\n", count, degreesPerFrame, disorder / frames,
+                fullMs, incrementalMs, fullMs / incrementalMs, incrementalFrames, frames, skippedFrames);
+    return 0;
+}
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    const int repeats = argc > 1 ? std::max(1, std::atoi(argv[1])) : 5;
+    const size_t sizes[] = {1u << 20, 4u << 20, 16u << 20};
+
+    RadixSorter sorter;
+    std::printf("threads: %u, repeats: %d\n", ThreadPool::Global().GetThreadCount(), repeats);
+    std::printf("%10s %14s %14s %9s\n", "keys", "std::sort(ms)", "radix(ms)", "speedup");
+
+    for (size_t count : sizes)
+    {
+        std::vector<uint32_t> baseKeys, baseValues;
+        GenerateKeys(count, 1234, baseKeys, baseValues);
+
+        // std::sort 基线：对 (key, index) 对排序，index 作为次关键字保证与稳定基数排序结果一致
+        std::vector<uint64_t> pairs(count);
+        double stdMs = 0.0;
+        for (int r = 0; r < repeats; ++r)
+        {
+            for (size_t i = 0; i < count; ++i)
+                pairs[i] = (static_cast<uint64_t>(baseKeys[i]) << 32) | baseValues[i];
+            auto start = std::chrono::steady_clock::now();
+            std::sort(pairs.begin(), pairs.end());
+            stdMs += ElapsedMs(start);
+        }
+
+        std::vector<uint32_t> keys, values;
+        double radixMs = 0.0;
+        for (int r = 0; r < repeats; ++r)
+        {
+            keys = baseKeys;
+            values = baseValues;
+            auto start = std::chrono::steady_clock::now();
+            sorter.Sort(keys.data(), values.data(), count);
+            radixMs += ElapsedMs(start);
+        }
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (keys[i] != static_cast<uint32_t>(pairs[i] >> 32) || values[i] != static_cast<uint32_t>(pairs[i]))
+            {
+                std::printf("MISMATCH at %zu for %zu keys\n", i, count);
+                return 1;
+            }
+        }
+
+        stdMs /= repeats;
+        radixMs /= repeats;
+        std::printf("%10zu %14.2f %14.2f %8.2fx\n", count, stdMs, radixMs, stdMs / radixMs);
+    }
+
+    std::printf("\norbit navigation, %d frames\n", repeats * 6);
+    std::printf("%10s %9s %9s %10s %15s %9s %s %s\n", "splats", "deg/frame", "disorder", "full(ms)",
+                "incremental(ms)", "speedup", "incremental frames", "skipped"); // skipped：退避中未尝试沿用排列的帧
+    const float orbitSteps[] = {0.0001f, 0.001f, 0.01f, 0.1f, 1.0f};
+    for (float step : orbitSteps)
+    {
+        if (RunOrbitBenchmark(1u << 20, repeats * 6, step) != 0)
+            return 1;
+    }
+    return 0;
+}
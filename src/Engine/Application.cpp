@@ -54,6 +54,23 @@ bool Application::Init()
 
     Renderer::RenderPipelineConfig config;
     config.shadowMapResolution = m_renderConfig.shadowMapResolution;
+    config.splatMaxSHDegree = m_renderConfig.splatMaxSHDegree;
+    config.splatMemoryBudget = m_renderConfig.splatMemoryBudgetMB * 1024 * 1024;
+    config.splatCompressed = m_renderConfig.splatCompressed;
+    config.splatCompressedHalfSH = m_renderConfig.splatCompressedHalfSH;
+    config.splatSHCodebookEntries = m_renderConfig.splatSHCodebookEntries;
+    config.splatAsyncSort = m_renderConfig.splatAsyncSort;
+    config.splatGpuSortThreshold = m_renderConfig.splatGpuSortThreshold;
+    config.splatGpuPreprocess = m_renderConfig.splatGpuPreprocess;
+    config.splatSHLod = m_renderConfig.splatSHLod;
+    for (int k = 0; k < 3; ++k)
+    {
+        config.splatSHLodRadius[k] = m_renderConfig.splatSHLodRadius[k];
+        config.splatSHLodDistance[k] = m_renderConfig.splatSHLodDistance[k];
+    }
+    config.splatLod = m_renderConfig.splatLod;
+    config.splatLodPixelError = m_renderConfig.splatLodPixelError;
+    config.splatDepthPrepass = m_renderConfig.splatDepthPrepass;
     m_renderPipeline = CreateRenderPipeline(m_appConfig.width, m_appConfig.height, *m_shaderManager, config);
     if (!m_renderPipeline)
     {
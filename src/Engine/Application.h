@@ -35,6 +35,20 @@ struct RenderConfig
     bool presentToScreen = true;
     int selectedUID = -1;
     int shadowMapResolution = 4096;
+    int splatMaxSHDegree = 3;      // 高斯点云加载时保留的最高球谐阶数（预览/低显存节点可设为 0）
+    size_t splatMemoryBudgetMB = 0; // 高斯点云存储预算（MB），0 表示不限制
+    bool splatCompressed = false;   // 量化上传高斯点云，显存约为 fp32 的 1/4
+    bool splatCompressedHalfSH = false; // 压缩上传时球谐用 fp16 而非 8 位量化
+    size_t splatSHCodebookEntries = 0; // 高阶球谐码本大小（配合 splatCompressed），0 表示不构建
+    bool splatAsyncSort = true;     // 高斯排序在后台线程进行，不阻塞渲染循环
+    size_t splatGpuSortThreshold = 5000000; // 点数不少于该值时在 GPU 上排序（此时不构建 LOD），0 表示始终使用 GPU
+    bool splatGpuPreprocess = true;         // GPU 排序路径由计算着色器剔除、投影并间接绘制，CPU 开销与点数无关
+    bool splatSHLod = true;         // 按屏幕半径/距离降低球谐求值阶数
+    float splatSHLodRadius[3] = {6.0f, 3.0f, 1.5f};   // 3σ 半径（像素）低于该值时分别降到 2/1/0 阶，0 表示不使用
+    float splatSHLodDistance[3] = {0.0f, 0.0f, 0.0f}; // 深度超过该值时分别降到 2/1/0 阶，0 表示不使用
+    bool splatLod = true;            // 大点云构建层次 LOD，远处用合并高斯代替原始高斯
+    float splatLodPixelError = 2.0f; // LOD 节点允许的屏幕误差（像素），越大合并越激进
+    bool splatDepthPrepass = false;  // 先写近乎不透明高斯的深度，主通道借 early-Z 跳过被挡住的片元
 };
 
 class Window;
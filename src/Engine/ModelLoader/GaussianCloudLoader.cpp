@@ -0,0 +1,794 @@
+#include "GaussianCloudLoader.h"
+#include "MappedFile.h"
+#include "Logger/Log.h"
+#include "Renderer/Core/ThreadPool.h"
+#include "Renderer/MathUtils/GaussianFuncUtils.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <sstream>
+#include <vector>
+
+using namespace Renderer;
+GSENGINE_NAMESPACE_BEGIN
+
+namespace
+{
+// 每个解码任务处理的顶点数
+const size_t DECODE_GRAIN_SIZE = 16384;
+
+// ---- .gsc 缓存格式 ----
+// [GscHeader][填充至 64 字节对齐][GaussianCloud 存储块（各属性段 64 字节对齐）]
+// [可选：SH 码字段（float）][可选：SH 码字下标段（uint16）]，码本两段同样 64 字节对齐
+const char GSC_MAGIC[4] = {'G', 'S', 'C', '\0'};
+const uint32_t GSC_VERSION = 2;
+const uint32_t GSC_ENDIAN_TAG = 0x01020304u;
+const int GSC_MAX_SECTIONS = 16;
+// GscHeader::flags
+const uint32_t GSC_FLAG_MORTON_ORDERED = 1u << 0;
+const uint32_t GSC_FLAG_SH_CODEBOOK = 1u << 1;
+
+struct GscHeader
+{
+    char magic[4];
+    uint32_t version;
+    uint32_t endianTag;
+    uint32_t shDegree;
+    uint64_t count;
+    uint32_t sectionCount;
+    uint32_t flags; // GSC_FLAG_*，旧版本写入为 0
+    float boundsMin[3];
+    float boundsMax[3];
+    uint64_t dataOffset; // 存储块在文件中的偏移
+    uint64_t dataSize;   // 存储块字节数
+    uint64_t sectionOffsets[GSC_MAX_SECTIONS]; // 各属性段相对存储块的偏移
+    // 以下仅在 GSC_FLAG_SH_CODEBOOK 时有效，码本阶数与点云相同
+    uint64_t shCodebookEntryCount;
+    uint64_t shCodebookOffset;      // 码字段在文件中的偏移（entryCount * 维度个 float）
+    uint64_t shCodebookIndexOffset; // 下标段在文件中的偏移（count 个 uint16）
+};
+static_assert(sizeof(GscHeader) % 8 == 0, "GscHeader must stay 8-byte packed");
+static_assert(static_cast<int>(GaussianCloud::Attribute::Count) <= GSC_MAX_SECTIONS, "too many cloud sections");
+
+uint64_t AlignUp64(uint64_t value)
+{
+    const uint64_t alignment = GaussianCloud::SECTION_ALIGNMENT;
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+enum class PlyScalarType
+{
+    Int8,
+    UInt8,
+    Int16,
+    UInt16,
+    Int32,
+    UInt32,
+    Float32,
+    Float64,
+    Invalid
+};
+
+struct PlyProperty
+{
+    std::string name;
+    PlyScalarType type = PlyScalarType::Invalid;
+    size_t offset = 0; // 在单个顶点记录中的字节偏移
+};
+
+struct PlyHeader
+{
+    size_t vertexCount = 0;
+    size_t vertexStride = 0;
+    size_t dataOffset = 0; // 顶点数据块在文件中的起始偏移
+    std::vector<PlyProperty> properties;
+};
+
+PlyScalarType ParseScalarType(const std::string &name)
+{
+    if (name == "char" || name == "int8")
+        return PlyScalarType::Int8;
+    if (name == "uchar" || name == "uint8")
+        return PlyScalarType::UInt8;
+    if (name == "short" || name == "int16")
+        return PlyScalarType::Int16;
+    if (name == "ushort" || name == "uint16")
+        return PlyScalarType::UInt16;
+    if (name == "int" || name == "int32")
+        return PlyScalarType::Int32;
+    if (name == "uint" || name == "uint32")
+        return PlyScalarType::UInt32;
+    if (name == "float" || name == "float32")
+        return PlyScalarType::Float32;
+    if (name == "double" || name == "float64")
+        return PlyScalarType::Float64;
+    return PlyScalarType::Invalid;
+}
+
+size_t ScalarSize(PlyScalarType type)
+{
+    switch (type)
+    {
+    case PlyScalarType::Int8:
+    case PlyScalarType::UInt8:
+        return 1;
+    case PlyScalarType::Int16:
+    case PlyScalarType::UInt16:
+        return 2;
+    case PlyScalarType::Int32:
+    case PlyScalarType::UInt32:
+    case PlyScalarType::Float32:
+        return 4;
+    case PlyScalarType::Float64:
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+template <typename T>
+inline float ReadAs(const unsigned char *p)
+{
+    T value;
+    std::memcpy(&value, p, sizeof(T));
+    return static_cast<float>(value);
+}
+
+// 3DGS 输出几乎全部为 float32，switch 分支对同一属性恒定，分支预测几乎无开销
+inline float ReadScalar(const unsigned char *p, PlyScalarType type)
+{
+    switch (type)
+    {
+    case PlyScalarType::Float32:
+        return ReadAs<float>(p);
+    case PlyScalarType::Float64:
+        return ReadAs<double>(p);
+    case PlyScalarType::Int8:
+        return ReadAs<int8_t>(p);
+    case PlyScalarType::UInt8:
+        return ReadAs<uint8_t>(p);
+    case PlyScalarType::Int16:
+        return ReadAs<int16_t>(p);
+    case PlyScalarType::UInt16:
+        return ReadAs<uint16_t>(p);
+    case PlyScalarType::Int32:
+        return ReadAs<int32_t>(p);
+    case PlyScalarType::UInt32:
+        return ReadAs<uint32_t>(p);
+    default:
+        return 0.0f;
+    }
+}
+
+// 解析 PLY 文本头，只接受 binary_little_endian，定位 vertex 元素的数据块
+bool ParsePlyHeader(const unsigned char *data, size_t size, PlyHeader &header, std::string &error)
+{
+    const char *text = reinterpret_cast<const char *>(data);
+    const char *endMarker = "end_header";
+    const size_t searchLimit = std::min<size_t>(size, 64 * 1024);
+    std::string headText(text, searchLimit);
+    size_t endPos = headText.find(endMarker);
+    if (headText.compare(0, 3, "ply") != 0 || endPos == std::string::npos)
+    {
+        error = "not a PLY file or header too large";
+        return false;
+    }
+    size_t lineEnd = headText.find('\n', endPos);
+    if (lineEnd == std::string::npos)
+    {
+        error = "truncated PLY header";
+        return false;
+    }
+
+    std::istringstream stream(headText.substr(0, endPos));
+    std::string line;
+    bool inVertexElement = false;
+    bool vertexSeen = false;
+    size_t bytesBeforeVertex = 0;
+    size_t currentElementCount = 0;
+    size_t currentElementStride = 0;
+
+    auto closeElement = [&]() {
+        if (!vertexSeen)
+            bytesBeforeVertex += currentElementCount * currentElementStride;
+        currentElementCount = 0;
+        currentElementStride = 0;
+    };
+
+    while (std::getline(stream, line))
+    {
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+        std::istringstream tokens(line);
+        std::string keyword;
+        tokens >> keyword;
+
+        if (keyword == "format")
+        {
+            std::string format;
+            tokens >> format;
+            if (format != "binary_little_endian")
+            {
+                error = "unsupported PLY format '" + format + "' (expected binary_little_endian)";
+                return false;
+            }
+        }
+        else if (keyword == "element")
+        {
+            if (inVertexElement)
+            {
+                inVertexElement = false;
+                vertexSeen = true;
+            }
+            else
+            {
+                closeElement();
+            }
+            std::string name;
+            size_t count = 0;
+            tokens >> name >> count;
+            if (name == "vertex" && !vertexSeen)
+            {
+                inVertexElement = true;
+                header.vertexCount = count;
+            }
+            else
+            {
+                currentElementCount = count;
+            }
+        }
+        else if (keyword == "property")
+        {
+            std::string typeName;
+            tokens >> typeName;
+            if (typeName == "list")
+            {
+                if (inVertexElement || !vertexSeen)
+                {
+                    error = "list properties before/in the vertex element are not supported";
+                    return false;
+                }
+                continue;
+            }
+            PlyScalarType type = ParseScalarType(typeName);
+            if (type == PlyScalarType::Invalid)
+            {
+                error = "unknown PLY property type '" + typeName + "'";
+                return false;
+            }
+            if (inVertexElement)
+            {
+                PlyProperty prop;
+                tokens >> prop.name;
+                prop.type = type;
+                prop.offset = header.vertexStride;
+                header.vertexStride += ScalarSize(type);
+                header.properties.push_back(prop);
+            }
+            else
+            {
+                currentElementStride += ScalarSize(type);
+            }
+        }
+    }
+
+    if (header.vertexCount == 0 || header.vertexStride == 0)
+    {
+        error = "PLY file has no vertex element";
+        return false;
+    }
+
+    header.dataOffset = lineEnd + 1 + bytesBeforeVertex;
+    if (header.dataOffset + header.vertexCount * header.vertexStride > size)
+    {
+        error = "PLY vertex data is truncated";
+        return false;
+    }
+    return true;
+}
+
+const PlyProperty *FindProperty(const PlyHeader &header, const std::string &name)
+{
+    for (const auto &prop : header.properties)
+    {
+        if (prop.name == name)
+            return &prop;
+    }
+    return nullptr;
+}
+} // namespace
+
+GaussianCloudLoader::GaussianCloudLoader()
+    : maxSHDegree_(GaussianCloud::MAX_SH_DEGREE), memoryBudget_(0), cacheEnabled_(true), mortonOrderEnabled_(true), shCodebookEntries_(0), loadedSplats_(0), loadSeconds_(0.0), loadedFromCache_(false)
+{
+}
+
+GaussianCloudLoader::~GaussianCloudLoader()
+{
+}
+
+std::shared_ptr<GaussianCloud> GaussianCloudLoader::loadCloud(const std::string &filename)
+{
+    loadedSplats_ = 0;
+    loadSeconds_ = 0.0;
+    loadedFromCache_ = false;
+    shCodebook_.reset();
+
+    if (!std::filesystem::exists(filename))
+    {
+        LOG_ERROR("Gaussian cloud file does not exist: {}", filename);
+        return nullptr;
+    }
+
+    std::string extension = std::filesystem::path(filename).extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), ::tolower);
+
+    auto start = std::chrono::steady_clock::now();
+    std::shared_ptr<GaussianCloud> cloud;
+    std::shared_ptr<const SHCodebook> shCodebook;
+
+    if (extension == ".gsc")
+    {
+        cloud = loadCache(filename, shCodebook);
+        loadedFromCache_ = cloud != nullptr;
+        if (cloud)
+        {
+            prepareCachedCloud(cloud, shCodebook);
+            // 单独的缓存没有源 PLY 可重新导入，只能不用码本
+            if (shCodebookEntries_ > 0 && cloud->GetSHDegree() > 0 && !shCodebook)
+                LOG_WARN("Gaussian cloud cache has no matching SH codebook, codebook disabled: {}", filename);
+        }
+    }
+    else
+    {
+        // 缓存存在且不旧于源 PLY 时直接映射缓存
+        std::string cachePath = getCachePath(filename);
+        std::error_code ec;
+        if (cacheEnabled_ && std::filesystem::exists(cachePath, ec) &&
+            std::filesystem::last_write_time(cachePath, ec) >= std::filesystem::last_write_time(filename, ec))
+        {
+            cloud = loadCache(cachePath, shCodebook);
+            if (cloud)
+            {
+                prepareCachedCloud(cloud, shCodebook);
+                // 缓存中没有所需码本（未构建过或码字数不同）：重新导入 PLY，构建码本并刷新缓存
+                if (shCodebookEntries_ > 0 && cloud->GetSHDegree() > 0 && !shCodebook)
+                {
+                    LOG_INFO("Gaussian cloud cache has no matching SH codebook, re-importing: {}", filename);
+                    cloud.reset();
+                }
+            }
+            loadedFromCache_ = cloud != nullptr;
+        }
+
+        if (!cloud)
+        {
+            int fileSHDegree = 0;
+            cloud = loadPly(filename, fileSHDegree);
+            if (cloud)
+            {
+                // 先重排再算协方差，少搬运 6 个分量平面
+                if (mortonOrderEnabled_)
+                    cloud->ReorderMorton();
+                cloud->ComputeCovariances();
+                // 码本只在导入 PLY 时构建一次，随缓存保存
+                if (shCodebookEntries_ > 0 && cloud->GetSHDegree() > 0)
+                    shCodebook = buildSHCodebook(*cloud);
+                // 只缓存完整阶数的点云，降阶结果可随时从完整缓存快速得到
+                if (cacheEnabled_ && cloud->GetSHDegree() == fileSHDegree && !saveCache(*cloud, cachePath, shCodebook))
+                    LOG_WARN("Failed to write Gaussian cloud cache: {}", cachePath);
+            }
+        }
+    }
+
+    loadSeconds_ = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    if (cloud)
+    {
+        loadedSplats_ = cloud->GetCount();
+        shCodebook_ = shCodebook;
+        LOG_INFO("Gaussian cloud loaded{}: {} splats, SH degree {}, {:.2f} MB, {:.3f}s",
+                 loadedFromCache_ ? " (cache)" : "", loadedSplats_, cloud->GetSHDegree(),
+                 cloud->GetStorageSize() / (1024.0 * 1024.0), loadSeconds_);
+    }
+    return cloud;
+}
+
+void GaussianCloudLoader::prepareCachedCloud(std::shared_ptr<GaussianCloud> &cloud,
+                                             std::shared_ptr<const SHCodebook> &shCodebook) const
+{
+    // 缓存以写时复制映射，旧缓存可原地重排；重排后缓存中的码字下标不再对应，码本作废
+    if (mortonOrderEnabled_ && !cloud->IsMortonOrdered())
+    {
+        cloud->ReorderMorton();
+        shCodebook.reset();
+    }
+    int shDegree = selectSHDegree(cloud->GetCount(), cloud->GetSHDegree());
+    if (shDegree < cloud->GetSHDegree())
+    {
+        cloud = reduceSHDegree(*cloud, shDegree);
+        if (shCodebook)
+            shCodebook = shCodebook->ReduceSHDegree(shDegree);
+    }
+}
+
+std::shared_ptr<const SHCodebook> GaussianCloudLoader::buildSHCodebook(const GaussianCloud &cloud) const
+{
+    auto start = std::chrono::steady_clock::now();
+    SHCodebookParams params;
+    params.entryCount = std::min(shCodebookEntries_, SHCodebook::MAX_ENTRIES);
+    auto codebook = std::make_shared<SHCodebook>();
+    if (!codebook->Build(cloud, params))
+        return nullptr;
+    LOG_INFO("SH codebook built: {} entries, {:.2f} MB, {:.3f}s", codebook->GetEntryCount(),
+             codebook->GetMemorySize() / (1024.0 * 1024.0),
+             std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+    return codebook;
+}
+
+int GaussianCloudLoader::selectSHDegree(size_t count, int availableDegree) const
+{
+    int shDegree = std::max(0, std::min(availableDegree, maxSHDegree_));
+    if (memoryBudget_ == 0)
+        return shDegree;
+
+    size_t offsets[static_cast<int>(GaussianCloud::Attribute::Count)];
+    while (shDegree > 0 && GaussianCloud::GetLayout(count, shDegree, offsets) > memoryBudget_)
+        --shDegree;
+    size_t requiredSize = GaussianCloud::GetLayout(count, shDegree, offsets);
+    if (requiredSize > memoryBudget_)
+        LOG_WARN("Gaussian cloud needs {:.2f} MB even at SH degree 0, exceeding the {:.2f} MB budget",
+                 requiredSize / (1024.0 * 1024.0), memoryBudget_ / (1024.0 * 1024.0));
+    return shDegree;
+}
+
+std::shared_ptr<GaussianCloud> GaussianCloudLoader::reduceSHDegree(const GaussianCloud &cloud, int shDegree)
+{
+    using Attribute = GaussianCloud::Attribute;
+    auto reduced = std::make_shared<GaussianCloud>();
+    reduced->Allocate(cloud.GetCount(), shDegree);
+
+    for (int i = 0; i < static_cast<int>(Attribute::Count); ++i)
+    {
+        Attribute attr = static_cast<Attribute>(i);
+        if (attr != Attribute::SHRest)
+            std::memcpy(reduced->GetAttribute(attr), cloud.GetAttribute(attr), cloud.GetAttributeBytes(attr));
+    }
+
+    // SHRest 按通道主序：每个通道保留前 restCoeffs 个平面
+    const int srcRestCoeffs = GaussianCloud::GetSHRestCoeffCount(cloud.GetSHDegree());
+    const int dstRestCoeffs = GaussianCloud::GetSHRestCoeffCount(shDegree);
+    for (int channel = 0; channel < 3; ++channel)
+    {
+        for (int k = 0; k < dstRestCoeffs; ++k)
+        {
+            std::memcpy(reduced->GetComponent(Attribute::SHRest, channel * dstRestCoeffs + k),
+                        cloud.GetComponent(Attribute::SHRest, channel * srcRestCoeffs + k),
+                        cloud.GetCount() * sizeof(float));
+        }
+    }
+
+    reduced->SetBounds(cloud.GetBoundsMin(), cloud.GetBoundsMax());
+    reduced->SetMortonOrdered(cloud.IsMortonOrdered());
+    return reduced;
+}
+
+std::string GaussianCloudLoader::getCachePath(const std::string &plyFilename)
+{
+    return std::filesystem::path(plyFilename).replace_extension(".gsc").string();
+}
+
+bool GaussianCloudLoader::saveCache(const GaussianCloud &cloud, const std::string &filename,
+                                    const std::shared_ptr<const SHCodebook> &shCodebook)
+{
+    GscHeader header = {};
+    std::memcpy(header.magic, GSC_MAGIC, sizeof(GSC_MAGIC));
+    header.version = GSC_VERSION;
+    header.endianTag = GSC_ENDIAN_TAG;
+    header.shDegree = static_cast<uint32_t>(cloud.GetSHDegree());
+    header.count = cloud.GetCount();
+    header.sectionCount = static_cast<uint32_t>(GaussianCloud::Attribute::Count);
+    header.flags = cloud.IsMortonOrdered() ? GSC_FLAG_MORTON_ORDERED : 0;
+    for (int c = 0; c < 3; ++c)
+    {
+        header.boundsMin[c] = cloud.GetBoundsMin()[c];
+        header.boundsMax[c] = cloud.GetBoundsMax()[c];
+    }
+    header.dataOffset = AlignUp64(sizeof(GscHeader));
+    header.dataSize = cloud.GetStorageSize();
+    for (uint32_t i = 0; i < header.sectionCount; ++i)
+        header.sectionOffsets[i] = cloud.GetAttributeOffset(static_cast<GaussianCloud::Attribute>(i));
+
+    const bool writeCodebook = shCodebook && shCodebook->GetEntryCount() > 0 &&
+                               shCodebook->GetCount() == cloud.GetCount() &&
+                               shCodebook->GetSHDegree() == cloud.GetSHDegree();
+    if (writeCodebook)
+    {
+        header.flags |= GSC_FLAG_SH_CODEBOOK;
+        header.shCodebookEntryCount = shCodebook->GetEntryCount();
+        header.shCodebookOffset = AlignUp64(header.dataOffset + header.dataSize);
+        header.shCodebookIndexOffset = AlignUp64(header.shCodebookOffset + shCodebook->GetEntryDataSize());
+    }
+
+    // 先写临时文件再重命名，避免中断时留下残缺缓存
+    std::string tempPath = filename + ".tmp";
+    {
+        std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+        if (!out)
+            return false;
+        out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        std::vector<char> padding(header.dataOffset - sizeof(header), 0);
+        out.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+        out.write(reinterpret_cast<const char *>(cloud.GetStorage()), static_cast<std::streamsize>(header.dataSize));
+        if (writeCodebook)
+        {
+            padding.assign(header.shCodebookOffset - (header.dataOffset + header.dataSize), 0);
+            out.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+            out.write(reinterpret_cast<const char *>(shCodebook->GetEntryData()),
+                      static_cast<std::streamsize>(shCodebook->GetEntryDataSize()));
+            padding.assign(header.shCodebookIndexOffset - header.shCodebookOffset - shCodebook->GetEntryDataSize(), 0);
+            out.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+            out.write(reinterpret_cast<const char *>(shCodebook->GetIndexData()),
+                      static_cast<std::streamsize>(cloud.GetCount() * sizeof(uint16_t)));
+        }
+        if (!out)
+            return false;
+    }
+
+    std::error_code ec;
+    std::filesystem::rename(tempPath, filename, ec);
+    if (ec)
+    {
+        std::filesystem::remove(tempPath, ec);
+        return false;
+    }
+    LOG_INFO("Gaussian cloud cache written: {}", filename);
+    return true;
+}
+
+std::shared_ptr<GaussianCloud> GaussianCloudLoader::loadCache(const std::string &filename,
+                                                              std::shared_ptr<const SHCodebook> &shCodebook)
+{
+    shCodebook.reset();
+
+    // 以写时复制方式映射：允许后续原地修改（如重排），不会写回文件
+    auto file = std::make_shared<MappedFile>();
+    if (!file->Open(filename, true))
+        return nullptr;
+
+    if (file->GetSize() < sizeof(GscHeader))
+    {
+        LOG_WARN("Gaussian cloud cache is truncated: {}", filename);
+        return nullptr;
+    }
+
+    GscHeader header;
+    std::memcpy(&header, file->GetData(), sizeof(header));
+    if (std::memcmp(header.magic, GSC_MAGIC, sizeof(GSC_MAGIC)) != 0 || header.endianTag != GSC_ENDIAN_TAG)
+    {
+        LOG_WARN("Not a Gaussian cloud cache: {}", filename);
+        return nullptr;
+    }
+    if (header.version != GSC_VERSION)
+    {
+        LOG_WARN("Gaussian cloud cache version {} is outdated (expected {}): {}", header.version, GSC_VERSION,
+                 filename);
+        return nullptr;
+    }
+    if (header.shDegree > static_cast<uint32_t>(GaussianCloud::MAX_SH_DEGREE) ||
+        header.dataOffset % GaussianCloud::SECTION_ALIGNMENT != 0 ||
+        header.dataOffset + header.dataSize > file->GetSize())
+    {
+        LOG_WARN("Gaussian cloud cache is corrupt: {}", filename);
+        return nullptr;
+    }
+
+    // 段布局必须与当前版本的 GaussianCloud 完全一致才能零拷贝接管
+    size_t offsets[static_cast<int>(GaussianCloud::Attribute::Count)];
+    size_t expectedSize = GaussianCloud::GetLayout(header.count, static_cast<int>(header.shDegree), offsets);
+    bool layoutMatches = header.sectionCount == static_cast<uint32_t>(GaussianCloud::Attribute::Count) &&
+                         header.dataSize == expectedSize;
+    for (uint32_t i = 0; layoutMatches && i < header.sectionCount; ++i)
+        layoutMatches = header.sectionOffsets[i] == offsets[i];
+    if (!layoutMatches)
+    {
+        LOG_WARN("Gaussian cloud cache layout mismatch: {}", filename);
+        return nullptr;
+    }
+
+    // 别名构造：存储指针指向映射区内部，引用计数持有 MappedFile
+    std::shared_ptr<unsigned char> storage(file, file->GetMutableData() + header.dataOffset);
+
+    auto cloud = std::make_shared<GaussianCloud>();
+    if (!cloud->AdoptStorage(storage, header.dataSize, header.count, static_cast<int>(header.shDegree)))
+    {
+        LOG_WARN("Gaussian cloud cache could not be mapped: {}", filename);
+        return nullptr;
+    }
+    cloud->SetBounds(header.boundsMin, header.boundsMax);
+    cloud->SetMortonOrdered((header.flags & GSC_FLAG_MORTON_ORDERED) != 0);
+
+    // 码本两段同样零拷贝接管；只在请求了码本且码字数与请求一致时使用
+    if ((header.flags & GSC_FLAG_SH_CODEBOOK) != 0 && shCodebookEntries_ > 0)
+    {
+        const int shDegree = static_cast<int>(header.shDegree);
+        const size_t expectedEntries =
+            std::min({shCodebookEntries_, SHCodebook::MAX_ENTRIES, static_cast<size_t>(header.count)});
+        const uint64_t entryBytes = header.shCodebookEntryCount * GaussianCloud::GetSHRestCoeffCount(shDegree) * 3 *
+                                    sizeof(float);
+        const uint64_t indexBytes = header.count * sizeof(uint16_t);
+        if (header.shCodebookEntryCount != expectedEntries)
+        {
+            LOG_INFO("Gaussian cloud cache SH codebook has {} entries ({} requested): {}",
+                     header.shCodebookEntryCount, expectedEntries, filename);
+            return cloud;
+        }
+
+        bool codebookValid = header.shCodebookOffset % GaussianCloud::SECTION_ALIGNMENT == 0 &&
+                             header.shCodebookIndexOffset % GaussianCloud::SECTION_ALIGNMENT == 0 &&
+                             header.shCodebookOffset + entryBytes <= file->GetSize() &&
+                             header.shCodebookIndexOffset + indexBytes <= file->GetSize();
+        auto codebook = std::make_shared<SHCodebook>();
+        if (codebookValid)
+        {
+            std::shared_ptr<const float> entries(
+                file, reinterpret_cast<const float *>(file->GetData() + header.shCodebookOffset));
+            std::shared_ptr<const uint16_t> indices(
+                file, reinterpret_cast<const uint16_t *>(file->GetData() + header.shCodebookIndexOffset));
+            codebookValid = codebook->Adopt(entries, header.shCodebookEntryCount, indices, header.count, shDegree);
+        }
+        if (codebookValid)
+            shCodebook = codebook;
+        else
+            LOG_WARN("Gaussian cloud cache SH codebook is corrupt: {}", filename);
+    }
+    return cloud;
+}
+
+std::shared_ptr<GaussianCloud> GaussianCloudLoader::loadPly(const std::string &filename, int &fileSHDegree)
+{
+    MappedFile file;
+    if (!file.Open(filename))
+        return nullptr;
+
+    PlyHeader header;
+    std::string error;
+    if (!ParsePlyHeader(file.GetData(), file.GetSize(), header, error))
+    {
+        LOG_ERROR("Failed to parse PLY {}: {}", filename, error);
+        return nullptr;
+    }
+
+    // ---- 定位所需属性 ----
+    const char *requiredNames[] = {"x",       "y",       "z",       "f_dc_0", "f_dc_1", "f_dc_2", "opacity",
+                                   "scale_0", "scale_1", "scale_2", "rot_0",  "rot_1",  "rot_2",  "rot_3"};
+    const int requiredCount = static_cast<int>(sizeof(requiredNames) / sizeof(requiredNames[0]));
+    std::vector<PlyProperty> fields(requiredCount);
+    for (int i = 0; i < requiredCount; ++i)
+    {
+        const PlyProperty *prop = FindProperty(header, requiredNames[i]);
+        if (!prop)
+        {
+            LOG_ERROR("PLY {} is not a 3DGS checkpoint: missing property '{}'", filename, requiredNames[i]);
+            return nullptr;
+        }
+        fields[i] = *prop;
+    }
+
+    // f_rest_* 按通道主序存放：[R 的 K 个系数][G 的 K 个][B 的 K 个]
+    int fileRestTotal = 0;
+    while (FindProperty(header, "f_rest_" + std::to_string(fileRestTotal)))
+        ++fileRestTotal;
+    const int fileRestCoeffs = fileRestTotal / 3;
+    fileSHDegree = 0;
+    while (fileSHDegree < GaussianCloud::MAX_SH_DEGREE &&
+           GaussianCloud::GetSHRestCoeffCount(fileSHDegree + 1) <= fileRestCoeffs)
+        ++fileSHDegree;
+    // 超出阶数上限或预算的高阶系数不建立字段映射，解码时完全跳过
+    const int shDegree = selectSHDegree(header.vertexCount, fileSHDegree);
+    if (shDegree < fileSHDegree)
+        LOG_INFO("Gaussian cloud {}: keeping SH degree {} of {}", filename, shDegree, fileSHDegree);
+    const int restCoeffs = GaussianCloud::GetSHRestCoeffCount(shDegree);
+
+    std::vector<PlyProperty> restFields(restCoeffs * 3);
+    for (int channel = 0; channel < 3; ++channel)
+    {
+        for (int k = 0; k < restCoeffs; ++k)
+        {
+            restFields[channel * restCoeffs + k] =
+                *FindProperty(header, "f_rest_" + std::to_string(channel * fileRestCoeffs + k));
+        }
+    }
+
+    auto cloud = std::make_shared<GaussianCloud>();
+    cloud->Allocate(header.vertexCount, shDegree);
+
+    // ---- 并行解码顶点块 ----
+    float *pos[3], *scale[3], *rot[4], *dc[3];
+    for (int c = 0; c < 3; ++c)
+    {
+        pos[c] = cloud->GetComponent(GaussianCloud::Attribute::Position, c);
+        scale[c] = cloud->GetComponent(GaussianCloud::Attribute::Scale, c);
+        dc[c] = cloud->GetComponent(GaussianCloud::Attribute::SHDC, c);
+    }
+    for (int c = 0; c < 4; ++c)
+        rot[c] = cloud->GetComponent(GaussianCloud::Attribute::Rotation, c);
+    float *opacity = cloud->GetAttribute(GaussianCloud::Attribute::Opacity);
+    float *rest = cloud->GetAttribute(GaussianCloud::Attribute::SHRest);
+
+    ThreadPool &pool = ThreadPool::Global();
+    const unsigned int threadCount = pool.GetThreadCount();
+    std::vector<float> workerMin(threadCount * 3, std::numeric_limits<float>::max());
+    std::vector<float> workerMax(threadCount * 3, std::numeric_limits<float>::lowest());
+
+    const unsigned char *vertexData = file.GetData() + header.dataOffset;
+    const size_t stride = header.vertexStride;
+    const size_t count = header.vertexCount;
+
+    pool.ParallelFor(0, count, DECODE_GRAIN_SIZE, [&](size_t begin, size_t end, unsigned int worker) {
+        float localMin[3] = {workerMin[worker * 3], workerMin[worker * 3 + 1], workerMin[worker * 3 + 2]};
+        float localMax[3] = {workerMax[worker * 3], workerMax[worker * 3 + 1], workerMax[worker * 3 + 2]};
+
+        for (size_t i = begin; i < end; ++i)
+        {
+            const unsigned char *v = vertexData + i * stride;
+
+            for (int c = 0; c < 3; ++c)
+            {
+                float p = ReadScalar(v + fields[c].offset, fields[c].type);
+                pos[c][i] = p;
+                localMin[c] = std::min(localMin[c], p);
+                localMax[c] = std::max(localMax[c], p);
+
+                dc[c][i] = ReadScalar(v + fields[3 + c].offset, fields[3 + c].type);
+                scale[c][i] = std::exp(ReadScalar(v + fields[7 + c].offset, fields[7 + c].type));
+            }
+
+            opacity[i] = sigmoid(ReadScalar(v + fields[6].offset, fields[6].type));
+
+            // PLY 中 rot_0 为实部 w，存储时转为 (x, y, z, w)
+            float qw = ReadScalar(v + fields[10].offset, fields[10].type);
+            float qx = ReadScalar(v + fields[11].offset, fields[11].type);
+            float qy = ReadScalar(v + fields[12].offset, fields[12].type);
+            float qz = ReadScalar(v + fields[13].offset, fields[13].type);
+            float len = std::sqrt(qx * qx + qy * qy + qz * qz + qw * qw);
+            float invLen = len > 1e-8f ? 1.0f / len : 0.0f;
+            rot[0][i] = qx * invLen;
+            rot[1][i] = qy * invLen;
+            rot[2][i] = qz * invLen;
+            rot[3][i] = len > 1e-8f ? qw * invLen : 1.0f;
+
+            for (size_t k = 0; k < restFields.size(); ++k)
+            {
+                rest[k * count + i] = ReadScalar(v + restFields[k].offset, restFields[k].type);
+            }
+        }
+
+        for (int c = 0; c < 3; ++c)
+        {
+            workerMin[worker * 3 + c] = localMin[c];
+            workerMax[worker * 3 + c] = localMax[c];
+        }
+    });
+
+    float boundsMin[3] = {workerMin[0], workerMin[1], workerMin[2]};
+    float boundsMax[3] = {workerMax[0], workerMax[1], workerMax[2]};
+    for (unsigned int w = 1; w < threadCount; ++w)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            boundsMin[c] = std::min(boundsMin[c], workerMin[w * 3 + c]);
+            boundsMax[c] = std::max(boundsMax[c], workerMax[w * 3 + c]);
+        }
+    }
+    cloud->SetBounds(boundsMin, boundsMax);
+
+    return cloud;
+}
+
+GSENGINE_NAMESPACE_END
@@ -0,0 +1,141 @@
+#pragma once
+
+#include "Core.h"
+#include "Renderer/Splat/GaussianCloud.h"
+#include "Renderer/Splat/SHCodebook.h"
+#include <memory>
+#include <string>
+
+GSENGINE_NAMESPACE_BEGIN
+
+/// 3DGS 点云加载器
+/// 解析标准 3DGS 训练输出的 binary_little_endian PLY（x/y/z, f_dc_*, f_rest_*, opacity, scale_*, rot_*）
+/// 文件以内存映射方式读取，顶点块按线程切分并行解码，直接写入 GaussianCloud 的 SoA 数组，
+/// 同时完成 exp(scale) / sigmoid(opacity) / normalize(rotation) 激活
+///
+/// 首次导入 PLY 后会在同目录写出 .gsc 缓存：头部 + 包围盒 + 64 字节对齐的 SoA 属性段，
+/// 布局与 GaussianCloud 存储（即 GPU 缓冲）完全一致。后续启动直接映射缓存文件，零拷贝、无逐点计算
+///
+/// 导入后按 3D Morton 码重排高斯（见 GaussianCloud::ReorderMorton），缓存中保存重排后的顺序
+///
+/// 可限制保留的球谐阶数或字节预算（见 RenderPipelineConfig），高阶系数在解析时直接跳过；
+/// 缓存阶数高于限制时只拷贝所需的属性平面
+///
+/// 可选地在导入后为高阶球谐构建向量量化码本（SHCodebook），供压缩上传路径使用；
+/// 码本只在导入 PLY 时构建，随 .gsc 缓存保存，命中缓存时与点云一样零拷贝映射
+class GSENGINE_API GaussianCloudLoader
+{
+public:
+    GaussianCloudLoader();
+    ~GaussianCloudLoader();
+
+    /// 加载点云文件（.ply 或 .gsc），失败返回 nullptr
+    /// 对 .ply 会优先使用同名且不旧于源文件的 .gsc 缓存
+    std::shared_ptr<Renderer::GaussianCloud> loadCloud(const std::string &filename);
+
+    /// 将点云写为 .gsc 缓存文件，提供码本（数量与阶数须与点云一致）时一并写入
+    static bool saveCache(const Renderer::GaussianCloud &cloud, const std::string &filename,
+                          const std::shared_ptr<const Renderer::SHCodebook> &shCodebook = nullptr);
+    /// PLY 文件对应的缓存路径（扩展名替换为 .gsc）
+    static std::string getCachePath(const std::string &plyFilename);
+
+    /// 保留的最高球谐阶数 [0, 3]
+    void setMaxSHDegree(int degree)
+    {
+        maxSHDegree_ = degree;
+    }
+    int getMaxSHDegree() const
+    {
+        return maxSHDegree_;
+    }
+    /// 点云存储字节预算，超出时逐级丢弃高阶球谐（0 表示不限制）
+    void setMemoryBudget(size_t bytes)
+    {
+        memoryBudget_ = bytes;
+    }
+    size_t getMemoryBudget() const
+    {
+        return memoryBudget_;
+    }
+
+    /// 高阶球谐码本的码字数（0 表示不构建，默认）；结果通过 getSHCodebook() 获取
+    /// 缓存中的码本码字数与此不符时，对 .ply 会重新导入并刷新缓存，对单独的 .gsc 则不使用码本
+    void setSHCodebookEntries(size_t entries)
+    {
+        shCodebookEntries_ = entries;
+    }
+    size_t getSHCodebookEntries() const
+    {
+        return shCodebookEntries_;
+    }
+    /// 最近一次 loadCloud 构建或从缓存映射的码本，没有时为 nullptr
+    std::shared_ptr<const Renderer::SHCodebook> getSHCodebook() const
+    {
+        return shCodebook_;
+    }
+
+    /// 是否在导入 PLY 后读写 .gsc 缓存（默认开启）
+    void setCacheEnabled(bool enabled)
+    {
+        cacheEnabled_ = enabled;
+    }
+    bool isCacheEnabled() const
+    {
+        return cacheEnabled_;
+    }
+
+    /// 是否在导入后按 Morton 序重排（默认开启）；未重排的旧缓存加载时会原地重排
+    void setMortonOrderEnabled(bool enabled)
+    {
+        mortonOrderEnabled_ = enabled;
+    }
+    bool isMortonOrderEnabled() const
+    {
+        return mortonOrderEnabled_;
+    }
+
+    // 获取加载统计信息
+    size_t getLoadedSplats() const
+    {
+        return loadedSplats_;
+    }
+    double getLoadSeconds() const
+    {
+        return loadSeconds_;
+    }
+    bool wasLoadedFromCache() const
+    {
+        return loadedFromCache_;
+    }
+
+private:
+    /// @param fileSHDegree 输出文件本身包含的球谐阶数
+    std::shared_ptr<Renderer::GaussianCloud> loadPly(const std::string &filename, int &fileSHDegree);
+    /// @param shCodebook 输出缓存中与当前码字数设置一致的码本，没有时为 nullptr
+    std::shared_ptr<Renderer::GaussianCloud> loadCache(const std::string &filename,
+                                                       std::shared_ptr<const Renderer::SHCodebook> &shCodebook);
+    // 缓存点云加载后的处理：按需重排与降阶，码本随之作废或降阶
+    void prepareCachedCloud(std::shared_ptr<Renderer::GaussianCloud> &cloud,
+                            std::shared_ptr<const Renderer::SHCodebook> &shCodebook) const;
+    std::shared_ptr<const Renderer::SHCodebook> buildSHCodebook(const Renderer::GaussianCloud &cloud) const;
+
+    // 在阶数上限与字节预算内为 count 个高斯选择球谐阶数
+    int selectSHDegree(size_t count, int availableDegree) const;
+    // 拷贝出低阶版本的点云（SoA 布局下只需逐平面拷贝保留的分量）
+    static std::shared_ptr<Renderer::GaussianCloud> reduceSHDegree(const Renderer::GaussianCloud &cloud,
+                                                                   int shDegree);
+
+    int maxSHDegree_;
+    size_t memoryBudget_;
+    bool cacheEnabled_;
+    bool mortonOrderEnabled_;
+    size_t shCodebookEntries_;
+    std::shared_ptr<const Renderer::SHCodebook> shCodebook_;
+
+    // 加载统计
+    size_t loadedSplats_;
+    double loadSeconds_;
+    bool loadedFromCache_;
+};
+
+GSENGINE_NAMESPACE_END
@@ -0,0 +1,139 @@
+#include "MappedFile.h"
+#include "Logger/Log.h"
+
+#if defined(GSENGINE_OS_WINDOWS)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+GSENGINE_NAMESPACE_BEGIN
+
+MappedFile::MappedFile()
+{
+}
+
+MappedFile::~MappedFile()
+{
+    Close();
+}
+
+#if defined(GSENGINE_OS_WINDOWS)
+
+bool MappedFile::Open(const std::string &path, bool copyOnWrite)
+{
+    Close();
+
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                              FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+        LOG_ERROR("MappedFile: failed to open {}", path);
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0)
+    {
+        LOG_ERROR("MappedFile: empty or unreadable file {}", path);
+        CloseHandle(file);
+        return false;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, copyOnWrite ? PAGE_WRITECOPY : PAGE_READONLY, 0, 0, nullptr);
+    if (!mapping)
+    {
+        LOG_ERROR("MappedFile: CreateFileMapping failed for {}", path);
+        CloseHandle(file);
+        return false;
+    }
+
+    void *view = MapViewOfFile(mapping, copyOnWrite ? FILE_MAP_COPY : FILE_MAP_READ, 0, 0, 0);
+    if (!view)
+    {
+        LOG_ERROR("MappedFile: MapViewOfFile failed for {}", path);
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+
+    m_fileHandle = file;
+    m_mappingHandle = mapping;
+    m_data = static_cast<const unsigned char *>(view);
+    m_size = static_cast<size_t>(fileSize.QuadPart);
+    m_copyOnWrite = copyOnWrite;
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (m_data)
+        UnmapViewOfFile(m_data);
+    if (m_mappingHandle)
+        CloseHandle(static_cast<HANDLE>(m_mappingHandle));
+    if (m_fileHandle)
+        CloseHandle(static_cast<HANDLE>(m_fileHandle));
+    m_data = nullptr;
+    m_size = 0;
+    m_copyOnWrite = false;
+    m_mappingHandle = nullptr;
+    m_fileHandle = nullptr;
+}
+
+#else
+
+bool MappedFile::Open(const std::string &path, bool copyOnWrite)
+{
+    Close();
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        LOG_ERROR("MappedFile: failed to open {}", path);
+        return false;
+    }
+
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || st.st_size == 0)
+    {
+        LOG_ERROR("MappedFile: empty or unreadable file {}", path);
+        ::close(fd);
+        return false;
+    }
+
+    int protection = copyOnWrite ? (PROT_READ | PROT_WRITE) : PROT_READ;
+    void *view = ::mmap(nullptr, static_cast<size_t>(st.st_size), protection, MAP_PRIVATE, fd, 0);
+    if (view == MAP_FAILED)
+    {
+        LOG_ERROR("MappedFile: mmap failed for {}", path);
+        ::close(fd);
+        return false;
+    }
+    // 加载阶段会被多个线程整体扫描一遍，提示内核提前预读
+    ::madvise(view, static_cast<size_t>(st.st_size), MADV_WILLNEED);
+
+    m_fd = fd;
+    m_data = static_cast<const unsigned char *>(view);
+    m_size = static_cast<size_t>(st.st_size);
+    m_copyOnWrite = copyOnWrite;
+    return true;
+}
+
+void MappedFile::Close()
+{
+    if (m_data)
+        ::munmap(const_cast<unsigned char *>(m_data), m_size);
+    if (m_fd >= 0)
+        ::close(m_fd);
+    m_data = nullptr;
+    m_size = 0;
+    m_copyOnWrite = false;
+    m_fd = -1;
+}
+
+#endif
+
+GSENGINE_NAMESPACE_END
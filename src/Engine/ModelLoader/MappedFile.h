@@ -0,0 +1,54 @@
+#pragma once
+
+#include "Core.h"
+#include <cstddef>
+#include <string>
+
+GSENGINE_NAMESPACE_BEGIN
+
+/// 只读内存映射文件（Windows: CreateFileMapping / POSIX: mmap）
+/// 用于大体积点云文件的零拷贝读取，映射在析构或 Close() 时释放
+class GSENGINE_API MappedFile
+{
+public:
+    MappedFile();
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    /// @param copyOnWrite 为 true 时映射为私有写时复制页：允许原地修改，修改不会写回文件
+    bool Open(const std::string &path, bool copyOnWrite = false);
+    void Close();
+
+    bool IsOpen() const
+    {
+        return m_data != nullptr;
+    }
+    const unsigned char *GetData() const
+    {
+        return m_data;
+    }
+    /// 仅在以 copyOnWrite 方式打开时可写
+    unsigned char *GetMutableData() const
+    {
+        return m_copyOnWrite ? const_cast<unsigned char *>(m_data) : nullptr;
+    }
+    size_t GetSize() const
+    {
+        return m_size;
+    }
+
+private:
+    const unsigned char *m_data = nullptr;
+    size_t m_size = 0;
+    bool m_copyOnWrite = false;
+#if defined(GSENGINE_OS_WINDOWS)
+    void *m_fileHandle = nullptr;
+    void *m_mappingHandle = nullptr;
+#else
+    int m_fd = -1;
+#endif
+};
+
+GSENGINE_NAMESPACE_END
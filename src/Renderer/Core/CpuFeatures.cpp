@@ -0,0 +1,111 @@
+#include "CpuFeatures.h"
+
+#if RENDERER_ARCH_X86
+#if defined(_MSC_VER)
+#include <immintrin.h>
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+#endif
+
+RENDERER_NAMESPACE_BEGIN
+
+namespace
+{
+struct FeatureFlags
+{
+    bool sse41 = false;
+    bool avx2 = false;
+};
+
+#if RENDERER_ARCH_X86
+void QueryCpuid(unsigned int leaf, unsigned int subleaf, unsigned int regs[4])
+{
+#if defined(_MSC_VER)
+    int info[4];
+    __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subleaf));
+    for (int i = 0; i < 4; ++i)
+        regs[i] = static_cast<unsigned int>(info[i]);
+#else
+    __cpuid_count(leaf, subleaf, regs[0], regs[1], regs[2], regs[3]);
+#endif
+}
+
+unsigned long long ReadXCR0()
+{
+#if defined(_MSC_VER)
+    return _xgetbv(0);
+#else
+    unsigned int eax, edx;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<unsigned long long>(edx) << 32) | eax;
+#endif
+}
+#endif
+
+FeatureFlags DetectFeatures()
+{
+    FeatureFlags flags;
+#if RENDERER_ARCH_X86
+    unsigned int regs[4] = {0, 0, 0, 0};
+    QueryCpuid(0, 0, regs);
+    const unsigned int maxLeaf = regs[0];
+    if (maxLeaf < 1)
+        return flags;
+
+    QueryCpuid(1, 0, regs);
+    flags.sse41 = (regs[2] & (1u << 19)) != 0;
+    const bool osxsave = (regs[2] & (1u << 27)) != 0;
+    const bool avx = (regs[2] & (1u << 28)) != 0;
+
+    // AVX2 还要求操作系统保存 YMM 寄存器状态（XCR0 的 bit 1、2）
+    if (maxLeaf >= 7 && osxsave && avx && (ReadXCR0() & 0x6) == 0x6)
+    {
+        QueryCpuid(7, 0, regs);
+        flags.avx2 = (regs[1] & (1u << 5)) != 0;
+    }
+#endif
+    return flags;
+}
+
+const FeatureFlags &GetFlags()
+{
+    static const FeatureFlags flags = DetectFeatures();
+    return flags;
+}
+} // namespace
+
+bool CpuFeatures::HasSSE41()
+{
+    return GetFlags().sse41;
+}
+
+bool CpuFeatures::HasAVX2()
+{
+    return GetFlags().avx2;
+}
+
+CpuFeatures::SIMDLevel CpuFeatures::GetSIMDLevel()
+{
+    if (HasAVX2())
+        return SIMDLevel::AVX2;
+    if (HasSSE41())
+        return SIMDLevel::SSE41;
+    return SIMDLevel::Scalar;
+}
+
+const char *CpuFeatures::GetSIMDLevelName(SIMDLevel level)
+{
+    switch (level)
+    {
+    case SIMDLevel::AVX2:
+        return "AVX2";
+    case SIMDLevel::SSE41:
+        return "SSE4.1";
+    default:
+        return "Scalar";
+    }
+}
+
+RENDERER_NAMESPACE_END
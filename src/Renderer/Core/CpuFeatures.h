@@ -0,0 +1,42 @@
+#pragma once
+
+#include "RenderCore.h"
+
+// 是否为 x86/x64 目标（SIMD 内核仅在此类平台编译，其余平台只走标量路径）
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define RENDERER_ARCH_X86 1
+#else
+#define RENDERER_ARCH_X86 0
+#endif
+
+// 为单个函数开启指令集（GCC/Clang 按函数指定 target，MSVC 无需声明即可使用内建函数）
+// 调用方必须先通过 CpuFeatures 确认运行时支持
+#if RENDERER_ARCH_X86 && !defined(_MSC_VER)
+#define RENDERER_TARGET_SSE41 __attribute__((target("sse4.1")))
+#define RENDERER_TARGET_AVX2 __attribute__((target("avx2")))
+#else
+#define RENDERER_TARGET_SSE41
+#define RENDERER_TARGET_AVX2
+#endif
+
+RENDERER_NAMESPACE_BEGIN
+
+/// 运行时 CPU 指令集检测（结果在首次调用时缓存）
+class RENDERER_API CpuFeatures
+{
+public:
+    enum class SIMDLevel
+    {
+        Scalar = 0,
+        SSE41,
+        AVX2
+    };
+
+    static bool HasSSE41();
+    static bool HasAVX2();
+    /// 当前 CPU 可用的最高 SIMD 等级
+    static SIMDLevel GetSIMDLevel();
+    static const char *GetSIMDLevelName(SIMDLevel level);
+};
+
+RENDERER_NAMESPACE_END
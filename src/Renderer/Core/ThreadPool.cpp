@@ -0,0 +1,137 @@
+#include "ThreadPool.h"
+#include <algorithm>
+
+RENDERER_NAMESPACE_BEGIN
+
+// 当前线程正在为哪个线程池执行任务（用于检测嵌套调用）
+static thread_local const ThreadPool *t_executingPool = nullptr;
+
+ThreadPool::ThreadPool(unsigned int threadCount)
+{
+    if (threadCount == 0)
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+    m_workers.reserve(threadCount - 1);
+    for (unsigned int i = 1; i < threadCount; ++i)
+    {
+        m_workers.emplace_back([this, i]() { WorkerLoop(i); });
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wakeCondition.notify_all();
+    for (auto &worker : m_workers)
+    {
+        if (worker.joinable())
+            worker.join();
+    }
+}
+
+ThreadPool &ThreadPool::Global()
+{
+    static ThreadPool s_pool;
+    return s_pool;
+}
+
+void ThreadPool::ParallelFor(size_t begin, size_t end, size_t grainSize, const RangeFunc &func)
+{
+    if (begin >= end)
+        return;
+    grainSize = std::max<size_t>(1, grainSize);
+
+    const size_t chunkCount = (end - begin + grainSize - 1) / grainSize;
+
+    // 单块任务、无工作线程或嵌套调用：直接在当前线程串行执行
+    if (chunkCount == 1 || m_workers.empty() || t_executingPool == this)
+    {
+        for (size_t chunkBegin = begin; chunkBegin < end; chunkBegin += grainSize)
+        {
+            func(chunkBegin, std::min(end, chunkBegin + grainSize), 0);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> submitLock(m_submitMutex);
+
+    Job job;
+    job.func = &func;
+    job.begin = begin;
+    job.end = end;
+    job.grainSize = grainSize;
+    job.chunkCount = chunkCount;
+    job.pendingChunks.store(chunkCount);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_job = &job;
+        ++m_generation;
+    }
+    m_wakeCondition.notify_all();
+
+    // 调用线程作为 0 号 worker 参与执行
+    const ThreadPool *previous = t_executingPool;
+    t_executingPool = this;
+    RunChunks(job, 0);
+    t_executingPool = previous;
+
+    // 等待所有块完成且所有工作线程都已离开该 Job（Job 位于调用栈上）
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_doneCondition.wait(lock, [&]() { return job.pendingChunks.load() == 0 && m_activeWorkers == 0; });
+    m_job = nullptr;
+}
+
+void ThreadPool::RunChunks(Job &job, unsigned int workerIndex)
+{
+    while (true)
+    {
+        const size_t chunk = job.nextChunk.fetch_add(1);
+        if (chunk >= job.chunkCount)
+            break;
+
+        const size_t chunkBegin = job.begin + chunk * job.grainSize;
+        const size_t chunkEnd = std::min(job.end, chunkBegin + job.grainSize);
+        (*job.func)(chunkBegin, chunkEnd, workerIndex);
+
+        if (job.pendingChunks.fetch_sub(1) == 1)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_doneCondition.notify_all();
+        }
+    }
+}
+
+void ThreadPool::WorkerLoop(unsigned int workerIndex)
+{
+    t_executingPool = this;
+    unsigned long long seenGeneration = 0;
+
+    while (true)
+    {
+        Job *job = nullptr;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wakeCondition.wait(lock, [&]() { return m_stop || (m_job && m_generation != seenGeneration); });
+            if (m_stop)
+                return;
+
+            seenGeneration = m_generation;
+            job = m_job;
+            ++m_activeWorkers;
+        }
+
+        RunChunks(*job, workerIndex);
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            --m_activeWorkers;
+        }
+        m_doneCondition.notify_all();
+    }
+}
+
+RENDERER_NAMESPACE_END
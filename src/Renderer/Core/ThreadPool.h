@@ -0,0 +1,98 @@
+#pragma once
+
+#include "RenderCore.h"
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+RENDERER_NAMESPACE_BEGIN
+
+/// 常驻线程池：用于 Splat 加载/预处理等可切块的数据并行任务
+/// 调用线程本身也参与执行（workerIndex = 0），工作线程编号为 1..N
+class RENDERER_API ThreadPool
+{
+public:
+    /// 工作函数：处理 [begin, end) 区间，workerIndex 可用于索引每线程的私有数据（如直方图）
+    using RangeFunc = std::function<void(size_t begin, size_t end, unsigned int workerIndex)>;
+
+    /// @param threadCount 参与执行的总线程数（含调用线程），0 表示使用硬件并发数
+    explicit ThreadPool(unsigned int threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /// 进程级共享线程池
+    static ThreadPool &Global();
+
+    /// 参与执行的总线程数（含调用线程），即 workerIndex 的上界
+    unsigned int GetThreadCount() const
+    {
+        return static_cast<unsigned int>(m_workers.size()) + 1;
+    }
+
+    /// 将 [begin, end) 按 grainSize 切块并行执行，阻塞直到全部完成
+    /// 在工作线程内部嵌套调用时退化为串行执行，避免死锁
+    void ParallelFor(size_t begin, size_t end, size_t grainSize, const RangeFunc &func);
+
+    /// 并行流压缩：按 [0, count) 的原有顺序，对第 k 个满足 keep(i) 的元素调用 emit(i, k)，返回保留个数
+    /// 先分块计数、求块间前缀和，再各块并行写出；keep 会被调用两次，应当廉价且无副作用
+    template <typename Keep, typename Emit> size_t ParallelCompact(size_t count, size_t grainSize, Keep keep, Emit emit)
+    {
+        grainSize = grainSize > 0 ? grainSize : 1;
+        std::vector<size_t> blockOffsets((count + grainSize - 1) / grainSize, 0);
+        ParallelFor(0, count, grainSize, [&](size_t begin, size_t end, unsigned int) {
+            size_t kept = 0;
+            for (size_t i = begin; i < end; ++i)
+                kept += keep(i) ? 1 : 0;
+            blockOffsets[begin / grainSize] = kept;
+        });
+        size_t total = 0;
+        for (size_t &offset : blockOffsets)
+        {
+            const size_t kept = offset;
+            offset = total;
+            total += kept;
+        }
+        ParallelFor(0, count, grainSize, [&](size_t begin, size_t end, unsigned int) {
+            size_t cursor = blockOffsets[begin / grainSize];
+            for (size_t i = begin; i < end; ++i)
+            {
+                if (keep(i))
+                    emit(i, cursor++);
+            }
+        });
+        return total;
+    }
+
+private:
+    struct Job
+    {
+        const RangeFunc *func = nullptr;
+        size_t begin = 0;
+        size_t end = 0;
+        size_t grainSize = 1;
+        size_t chunkCount = 0;
+        std::atomic<size_t> nextChunk{0};
+        std::atomic<size_t> pendingChunks{0};
+    };
+
+    void WorkerLoop(unsigned int workerIndex);
+    void RunChunks(Job &job, unsigned int workerIndex);
+
+    std::vector<std::thread> m_workers;
+    std::mutex m_mutex;
+    std::mutex m_submitMutex; // 同一线程池同时只执行一个 ParallelFor
+    std::condition_variable m_wakeCondition;
+    std::condition_variable m_doneCondition;
+    Job *m_job = nullptr;
+    unsigned long long m_generation = 0;
+    unsigned int m_activeWorkers = 0;
+    bool m_stop = false;
+};
+
+RENDERER_NAMESPACE_END
@@ -0,0 +1,39 @@
+#include "Effects/SplatOITCompositeEffect.h"
+#include "RenderContext.h"
+#include <glad/glad.h>
+
+RENDERER_NAMESPACE_BEGIN
+
+SplatOITCompositeEffect::SplatOITCompositeEffect(const std::shared_ptr<Shader> &shader)
+    : m_shader(shader)
+{
+}
+
+bool SplatOITCompositeEffect::IsActive(const RenderContext &ctx) const
+{
+    return ctx.splatAccumTex != 0 && ctx.splatRevealageTex != 0;
+}
+
+void SplatOITCompositeEffect::Apply(unsigned int inputTex, unsigned int quadVAO,
+                                     int /*width*/, int /*height*/, const RenderContext &ctx)
+{
+    m_shader->use();
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, inputTex);
+    m_shader->setInt("u_sceneTexture", 0);
+    glActiveTexture(GL_TEXTURE1);
+    glBindTexture(GL_TEXTURE_2D, ctx.splatAccumTex);
+    m_shader->setInt("u_accumTexture", 1);
+    glActiveTexture(GL_TEXTURE2);
+    glBindTexture(GL_TEXTURE_2D, ctx.splatRevealageTex);
+    m_shader->setInt("u_revealageTexture", 2);
+
+    glBindVertexArray(quadVAO);
+    glDrawArrays(GL_TRIANGLE_FAN, 0, 4);
+    glBindVertexArray(0);
+
+    glActiveTexture(GL_TEXTURE0);
+    m_shader->unuse();
+}
+
+RENDERER_NAMESPACE_END
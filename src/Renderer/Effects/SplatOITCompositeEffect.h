@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Core/RenderCore.h"
+#include "PostProcessEffect.h"
+#include "Shader.h"
+#include <memory>
+
+RENDERER_NAMESPACE_BEGIN
+
+/// 高斯加权混合 OIT 合成效果
+/// 读取 SplatPass 写入 RenderContext 的 accum / revealage 纹理，按 avg · (1 - r) + scene · r 合成；
+/// 本帧未使用 OIT 模式（纹理为 0）时不执行。需位于效果链首位，使描边、Bloom 作用于合成后的画面
+class RENDERER_API SplatOITCompositeEffect : public PostProcessEffect
+{
+public:
+    explicit SplatOITCompositeEffect(const std::shared_ptr<Shader> &shader);
+    ~SplatOITCompositeEffect() override = default;
+
+    void Apply(unsigned int inputTex, unsigned int quadVAO,
+               int width, int height, const RenderContext &ctx) override;
+    bool IsActive(const RenderContext &ctx) const override;
+    const char *GetName() const override { return "SplatOITCompositeEffect"; }
+
+private:
+    std::shared_ptr<Shader> m_shader;
+};
+
+RENDERER_NAMESPACE_END
@@ -4,6 +4,7 @@
 #include "Quaternion.h"
 #include "Matrix.h"
 #include <cmath>
+#include <cstddef>
 
 RENDERER_NAMESPACE_BEGIN
 
@@ -40,6 +41,60 @@ public:
         matmul3x3(M, MT, cov3D);
     }
 
+    // 批量计算 3D 协方差（SoA 输入/输出，处理 [begin, end) 区间）
+    // 直接展开 Σ = (R·S)(R·S)^T 的 6 个独立元素，无临时矩阵与通用三重循环，循环体可被编译器自动向量化
+    // scale[3]: sx, sy, sz 平面；rotation[4]: qx, qy, qz, qw 平面（要求已归一化）
+    // cov6[6]: 输出 xx, xy, xz, yy, yz, zz 平面
+    static void compute3DCovarianceBatch(
+        const FLOAT* const* scale,
+        const FLOAT* const* rotation,
+        FLOAT* const* cov6,
+        size_t begin,
+        size_t end)
+    {
+        const FLOAT* sxs = scale[0];
+        const FLOAT* sys = scale[1];
+        const FLOAT* szs = scale[2];
+        const FLOAT* qxs = rotation[0];
+        const FLOAT* qys = rotation[1];
+        const FLOAT* qzs = rotation[2];
+        const FLOAT* qws = rotation[3];
+        FLOAT* cxx = cov6[0];
+        FLOAT* cxy = cov6[1];
+        FLOAT* cxz = cov6[2];
+        FLOAT* cyy = cov6[3];
+        FLOAT* cyz = cov6[4];
+        FLOAT* czz = cov6[5];
+
+        for (size_t i = begin; i < end; ++i) {
+            const FLOAT x = qxs[i], y = qys[i], z = qzs[i], w = qws[i];
+            const FLOAT xx = x * x, yy = y * y, zz = z * z;
+            const FLOAT xy = x * y, xz = x * z, yz = y * z;
+            const FLOAT wx = w * x, wy = w * y, wz = w * z;
+
+            // M = R * S：R 的第 j 列乘以 s_j
+            const FLOAT sx = sxs[i], sy = sys[i], sz = szs[i];
+            const FLOAT m00 = (1 - 2 * (yy + zz)) * sx, m01 = 2 * (xy - wz) * sy, m02 = 2 * (xz + wy) * sz;
+            const FLOAT m10 = 2 * (xy + wz) * sx, m11 = (1 - 2 * (xx + zz)) * sy, m12 = 2 * (yz - wx) * sz;
+            const FLOAT m20 = 2 * (xz - wy) * sx, m21 = 2 * (yz + wx) * sy, m22 = (1 - 2 * (xx + yy)) * sz;
+
+            cxx[i] = m00 * m00 + m01 * m01 + m02 * m02;
+            cxy[i] = m00 * m10 + m01 * m11 + m02 * m12;
+            cxz[i] = m00 * m20 + m01 * m21 + m02 * m22;
+            cyy[i] = m10 * m10 + m11 * m11 + m12 * m12;
+            cyz[i] = m10 * m20 + m11 * m21 + m12 * m22;
+            czz[i] = m20 * m20 + m21 * m21 + m22 * m22;
+        }
+    }
+
+    // 将 6 个独立元素 (xx, xy, xz, yy, yz, zz) 展开为行主序 3x3 对称矩阵
+    static void expandCovariance(const FLOAT* cov6, FLOAT* cov3D)
+    {
+        cov3D[0] = cov6[0]; cov3D[1] = cov6[1]; cov3D[2] = cov6[2];
+        cov3D[3] = cov6[1]; cov3D[4] = cov6[3]; cov3D[5] = cov6[4];
+        cov3D[6] = cov6[2]; cov3D[7] = cov6[4]; cov3D[8] = cov6[5];
+    }
+
     // 将3D协方差投影到2D屏幕空间
     // 这是简化版本，完整版需要雅可比矩阵
     static void project3DCovariance(
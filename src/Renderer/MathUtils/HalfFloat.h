@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Core/RenderCore.h"
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+RENDERER_NAMESPACE_BEGIN
+
+/// float32 -> IEEE 754 half（就近舍入到偶数，溢出饱和为 inf，与 GLSL unpackHalf2x16 对应）
+inline uint16_t floatToHalf(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    const uint32_t sign = (bits >> 16) & 0x8000u;
+    const uint32_t rawExponent = (bits >> 23) & 0xffu;
+    uint32_t mantissa = bits & 0x7fffffu;
+
+    if (rawExponent == 0xffu)
+        return static_cast<uint16_t>(sign | 0x7c00u | (mantissa ? 0x200u : 0u));
+
+    const int exponent = static_cast<int>(rawExponent) - 127 + 15;
+    if (exponent >= 31)
+        return static_cast<uint16_t>(sign | 0x7c00u);
+
+    if (exponent <= 0)
+    {
+        // 非规格化数
+        if (exponent < -10)
+            return static_cast<uint16_t>(sign);
+        mantissa |= 0x800000u;
+        const uint32_t shift = static_cast<uint32_t>(14 - exponent);
+        uint32_t half = mantissa >> shift;
+        const uint32_t remainder = mantissa & ((1u << shift) - 1u);
+        const uint32_t midpoint = 1u << (shift - 1u);
+        if (remainder > midpoint || (remainder == midpoint && (half & 1u)))
+            ++half;
+        return static_cast<uint16_t>(sign | half);
+    }
+
+    uint32_t half = sign | (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13);
+    const uint32_t remainder = mantissa & 0x1fffu;
+    // 进位会自然溢出到指数位
+    if (remainder > 0x1000u || (remainder == 0x1000u && (half & 1u)))
+        ++half;
+    return static_cast<uint16_t>(half);
+}
+
+/// IEEE 754 half -> float32
+inline float halfToFloat(uint16_t half)
+{
+    const uint32_t sign = (static_cast<uint32_t>(half) & 0x8000u) << 16;
+    const uint32_t exponent = (half >> 10) & 0x1fu;
+    const uint32_t mantissa = half & 0x3ffu;
+
+    if (exponent == 0)
+    {
+        const float magnitude = std::ldexp(static_cast<float>(mantissa), -24);
+        return sign ? -magnitude : magnitude;
+    }
+
+    uint32_t bits;
+    if (exponent == 31)
+        bits = sign | 0x7f800000u | (mantissa << 13);
+    else
+        bits = sign | ((exponent + 112u) << 23) | (mantissa << 13);
+
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+RENDERER_NAMESPACE_END
@@ -51,11 +51,11 @@ void PostProcessChain::Execute(RenderContext &ctx)
 {
     glDisable(GL_DEPTH_TEST);
 
-    // 收集启用的效果
+    // 收集启用且本帧需要执行的效果
     std::vector<PostProcessEffect *> activeEffects;
     for (auto &effect : m_effects)
     {
-        if (effect && effect->enabled)
+        if (effect && effect->enabled && effect->IsActive(ctx))
             activeEffects.push_back(effect.get());
     }
 
@@ -23,6 +23,9 @@ public:
     virtual void Apply(unsigned int inputTex, unsigned int quadVAO,
                        int width, int height, const RenderContext &ctx) = 0;
 
+    /// 本帧是否需要执行（在 enabled 之外按帧数据判断，返回 false 时整个效果连同其全屏绘制被跳过）
+    virtual bool IsActive(const RenderContext &ctx) const { (void)ctx; return true; }
+
     /// 当渲染尺寸变化时重建内部资源（默认无需处理）
     virtual void Resize(int width, int height) { (void)width; (void)height; }
 
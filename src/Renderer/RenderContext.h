@@ -93,6 +93,10 @@ struct RENDERER_API RenderContext
     // 光照结果（LightingPass 输出）
     unsigned int lightingTex = 0;
 
+    // 高斯加权混合 OIT 的累加结果（SplatPass 在 OIT 模式下输出，由 SplatOITCompositeEffect 合成），未使用时为 0
+    unsigned int splatAccumTex = 0;
+    unsigned int splatRevealageTex = 0;
+
     // 后处理结果（PostProcessPass 输出）
     unsigned int postProcessColorTex = 0;
 
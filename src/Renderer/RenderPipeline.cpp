@@ -10,6 +10,7 @@
 #include "PostProcessChain.h"
 #include "Effects/OutlineEffect.h"
 #include "Effects/BloomEffect.h"
+#include "Effects/SplatOITCompositeEffect.h"
 #include "RenderContext.h"
 #include "ShaderManager.h"
 #include "Logger/Log.h"
@@ -22,7 +23,7 @@ static const std::vector<const char *> s_viewModeLabels = {
     "Final (PostProcess)", "Lighting", "Position", "Normal", "Diffuse", "Specular", "Depth", "SSAO"};
 
 RenderPipeline::RenderPipeline(int width, int height, ShaderManager &shaderManager, const RenderPipelineConfig &config)
-    : m_width(width), m_height(height)
+    : m_config(config), m_width(width), m_height(height)
 {
     // 通过 ShaderManager 统一加载所有内置 Shader
     auto basepassShader =
@@ -44,9 +45,12 @@ RenderPipeline::RenderPipeline(int width, int height, ShaderManager &shaderManag
         shaderManager.LoadShader("bloom_blur", "res/shaders/final.vs.glsl", "res/shaders/bloom_blur.fs.glsl");
     auto bloomCompositeShader =
         shaderManager.LoadShader("bloom_composite", "res/shaders/final.vs.glsl", "res/shaders/bloom_composite.fs.glsl");
+    auto splatOITCompositeShader = shaderManager.LoadShader("splat_oit_composite", "res/shaders/final.vs.glsl",
+                                                            "res/shaders/splat_oit_composite.fs.glsl");
 
     if (!basepassShader || !lambertShader || !pbrShader || !outlineShader || !finalShader || !bloomThresholdShader ||
-        !bloomBlurShader || !bloomCompositeShader || !shadowShader || !ssaoShader || !ssaoBlurShader)
+        !bloomBlurShader || !bloomCompositeShader || !shadowShader || !ssaoShader || !ssaoBlurShader ||
+        !splatOITCompositeShader)
     {
         throw std::runtime_error("RenderPipeline initialization failed: required shader load failed");
     }
@@ -64,6 +68,8 @@ RenderPipeline::RenderPipeline(int width, int height, ShaderManager &shaderManag
 
     // 后处理效果链（替代原来的 PostProcessPass）
     auto ppChain = std::make_unique<PostProcessChain>(width, height);
+    // 高斯 OIT 合成须先于其余效果，描边与 Bloom 才能作用于含高斯的画面
+    ppChain->AddEffect(std::make_unique<SplatOITCompositeEffect>(splatOITCompositeShader));
     ppChain->AddEffect(std::make_unique<OutlineEffect>(outlineShader));
     ppChain->AddEffect(
         std::make_unique<BloomEffect>(width, height, bloomThresholdShader, bloomBlurShader, bloomCompositeShader));
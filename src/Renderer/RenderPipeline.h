@@ -28,9 +28,67 @@ enum class ViewMode
     SSAO,
 };
 
+/// 高斯混合方式
+enum class SplatBlendMode
+{
+    Sorted = 0,  // 每帧从后往前排序后预乘 alpha 混合（精确）
+    WeightedOIT, // 加权混合顺序无关透明，不排序（近似，用于快速浏览、预览与超大点云）
+};
+
 struct RenderPipelineConfig
 {
     int shadowMapResolution = 2048;
+    // 高斯点云加载限制：保留的最高球谐阶数 [0, 3]，以及点云存储的字节预算（0 表示不限制）
+    // 超出预算时从高阶开始逐级丢弃球谐带，在解析阶段即跳过，不读取也不转换被丢弃的系数
+    int splatMaxSHDegree = 3;
+    size_t splatMemoryBudget = 0;
+    // 以 CompressedGaussianCloud 量化上传点云（每个高斯 16 字节 + 8 位球谐，显存约为 fp32 的 1/4），着色器中反量化；
+    // CPU 端仍用 fp32 点云剔除与排序。开启时不构建 LOD
+    bool splatCompressed = false;
+    // 压缩上传时球谐系数以 fp16 保存（每系数 2 字节，精度高）；关闭时按块范围量化为 8 位（默认，显存减半）
+    bool splatCompressedHalfSH = false;
+    // 加载时为高阶球谐构建的码本大小（0 表示不构建），压缩上传时每个高斯只保存 16 位码字下标
+    size_t splatSHCodebookEntries = 0;
+    // 高斯排序放到后台线程双缓冲执行，渲染线程始终使用最近一次完成的顺序；关闭时在渲染线程同步排序
+    bool splatAsyncSort = true;
+    unsigned int splatSortThreads = 0; // 后台排序线程池大小，0 表示一半硬件并发数
+    // 排序后端按点数选择，优先级：GPU 排序 > LOD + CPU 排序 > CPU 排序
+    // 点数不少于该值时改用计算着色器在 GPU 上排序（省去每帧上传索引缓冲，此时不构建 LOD），0 表示始终使用 GPU 排序
+    size_t splatGpuSortThreshold = 5000000;
+    // GPU 排序路径改由计算着色器逐高斯变换、剔除、投影并求球谐，可见数写入间接绘制命令；
+    // 默认对不少于 splatGpuSortThreshold 的点云生效，阈值设为 0 时所有点云都走该路径
+    bool splatGpuPreprocess = true;
+    // 排序前按视锥（含保护带）、不透明度、屏幕半径剔除高斯，排序与上传只处理可见部分（CPU 排序路径）；
+    // LOD 选择与 GPU 预处理使用相同阈值，关闭时它们只保留视锥与近平面判定
+    bool splatCulling = true;
+    float splatCullGuardBand = 1.3f;           // 视锥放宽倍数
+    float splatCullMinOpacity = 1.0f / 255.0f; // 不透明度下限
+    float splatCullMinRadius = 0.3f;           // 3σ 屏幕半径下限（像素），0 表示不按大小剔除
+    size_t splatChunkSize = 1024;              // 剔除用空间分块的块大小（256~4096），0 表示不分块
+    // 层次 LOD：点数在 [splatLodMinSplats, splatGpuSortThreshold) 内时加载后构建 SplatLodTree，
+    // 每帧按屏幕空间误差选择合并高斯代替远处的原始高斯，选择结果代替剔除结果进入 CPU 排序；
+    // 更大的点云走 GPU 排序，不构建 LOD。开启 splatCompressed 时也不构建
+    bool splatLod = true;
+    size_t splatLodMinSplats = 1000000;
+    float splatLodPixelError = 2.0f; // 节点包围球投影半径低于该值（像素）时不再展开
+    // 深度预通道：先从前往后画不透明度不低于 splatDepthPrepassAlpha 的高斯，只在 α 不低于该阈值的片元写深度；
+    // 主通道据此做深度测试，被近乎不透明表面挡住的高斯片元在 early-Z 阶段即被拒绝。
+    // 被挡住部分的贡献不超过 1 - 阈值，阈值越接近 0.99（片元 α 上限）误差越小
+    bool splatDepthPrepass = false;
+    float splatDepthPrepassAlpha = 0.95f;
+    // 初始混合方式，运行时可用 SplatPass::SetBlendMode 切换
+    SplatBlendMode splatBlendMode = SplatBlendMode::Sorted;
+    // 点云预览：相机移动期间只把高斯中心画成 GL_POINTS（0 阶球谐颜色，不排序），
+    // 相机静止 splatPointPreviewStillMs 毫秒后自动恢复完整的高斯渲染；运行时可用 SplatPass::SetPointPreview 开关
+    bool splatPointPreview = false;
+    unsigned int splatPointPreviewStillMs = 250;
+    float splatPointSize = 2.0f; // 点大小（像素）
+    // 球谐 LOD：按 3σ 屏幕半径或视空间深度逐级降低着色器中的求值阶数，远处/很小的高斯只读 DC
+    // 第 k 项（k = 0, 1, 2）为降到 2 - k 阶的阈值：半径低于 splatSHLodRadius[k] 或深度超过 splatSHLodDistance[k]
+    // 阈值为 0 表示不使用该条件
+    bool splatSHLod = true;
+    float splatSHLodRadius[3] = {6.0f, 3.0f, 1.5f};
+    float splatSHLodDistance[3] = {0.0f, 0.0f, 0.0f};
 };
 
 /// 渲染管线：统一编排所有 RenderPass 的执行顺序
@@ -121,6 +179,10 @@ public:
     {
         return m_height;
     }
+    const RenderPipelineConfig &GetConfig() const
+    {
+        return m_config;
+    }
 
     // ---- Pass 管理 API ----
 
@@ -153,6 +215,7 @@ private:
     std::vector<RenderContext::ForwardRenderItem> m_forwardRenderables;
 
     // 管线配置
+    RenderPipelineConfig m_config;
     int m_width;
     int m_height;
     unsigned int m_lastDisplayTex = 0;
@@ -7,6 +7,10 @@
 RENDERER_NAMESPACE_BEGIN
 
 std::string Shader::readFile(const std::string &filepath) {
+    return readFile(filepath, 0);
+}
+
+std::string Shader::readFile(const std::string &filepath, int includeDepth) {
     std::ifstream file(filepath, std::ios::in | std::ios::binary);
     if (!file) {
         throw std::runtime_error("Failed to open shader file: " + filepath);
@@ -19,6 +23,34 @@ std::string Shader::readFile(const std::string &filepath) {
     file.seekg(0, std::ios::beg);
     file.read(&content[0], content.size());
     file.close();
+
+    // 展开 #include "xxx.glsl"（路径相对于当前文件所在目录），用于共享的 GLSL 函数库
+    const std::string directive = "#include";
+    size_t slash = filepath.find_last_of("/\\");
+    std::string directory = slash == std::string::npos ? std::string() : filepath.substr(0, slash + 1);
+    size_t pos = 0;
+    while ((pos = content.find(directive, pos)) != std::string::npos) {
+        // 只处理位于行首的指令，忽略注释等位置出现的同名文本
+        if (pos != 0 && content[pos - 1] != '\n') {
+            pos += directive.size();
+            continue;
+        }
+        size_t lineEnd = content.find('\n', pos);
+        if (lineEnd == std::string::npos) {
+            lineEnd = content.size();
+        }
+        size_t open = content.find('"', pos);
+        size_t close = open == std::string::npos ? std::string::npos : content.find('"', open + 1);
+        if (close == std::string::npos || close > lineEnd) {
+            throw std::runtime_error("Malformed #include in shader file: " + filepath);
+        }
+        if (includeDepth >= 8) {
+            throw std::runtime_error("Shader #include nesting too deep: " + filepath);
+        }
+        std::string included = readFile(directory + content.substr(open + 1, close - open - 1), includeDepth + 1);
+        content.replace(pos, lineEnd - pos, included);
+        pos += included.size();
+    }
     
     return content;
 }
@@ -29,6 +61,10 @@ std::shared_ptr<Shader> Shader::fromFiles(const std::string &vertexPath, const s
     return std::make_shared<Shader>(vertexSource, fragmentSource);
 }
 
+std::shared_ptr<Shader> Shader::fromComputeFile(const std::string &computePath) {
+    return std::make_shared<Shader>(readFile(computePath));
+}
+
 static void checkShaderCompile(GLuint shader, const char *stageName) {
     GLint success = 0;
     glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
@@ -58,13 +94,17 @@ static void checkProgramLink(GLuint program) {
 }
 
 unsigned int Shader::compileStage(int type, const std::string &source) {
-    GLenum glType = type == 0 ? GL_VERTEX_SHADER : (type == 1 ? GL_FRAGMENT_SHADER : GL_INVALID_ENUM);
-    GLuint shader = glCreateShader(glType);
+    static const GLenum glTypes[] = {GL_VERTEX_SHADER, GL_FRAGMENT_SHADER, GL_COMPUTE_SHADER};
+    static const char *stageNames[] = {"VERTEX", "FRAGMENT", "COMPUTE"};
+    if (type < 0 || type > 2) {
+        throw std::runtime_error("Invalid shader stage");
+    }
+    GLuint shader = glCreateShader(glTypes[type]);
     const char *src = source.c_str();
     glShaderSource(shader, 1, &src, nullptr);
     glCompileShader(shader);
 
-    const char *stageName = glType == GL_VERTEX_SHADER ? "VERTEX" : (type == GL_FRAGMENT_SHADER ? "FRAGMENT" : "INVALID_ENUM");
+    const char *stageName = stageNames[type];
     checkShaderCompile(shader, stageName);
     return shader;
 }
@@ -85,6 +125,17 @@ Shader::Shader(const std::string &vertexSource, const std::string &fragmentSourc
     checkProgramLink(programId_);
 }
 
+Shader::Shader(const std::string &computeSource) {
+    GLuint cs = compileStage(2, computeSource);
+
+    programId_ = glCreateProgram();
+    glAttachShader(programId_, cs);
+    glLinkProgram(programId_);
+    glDeleteShader(cs);
+
+    checkProgramLink(programId_);
+}
+
 Shader::~Shader() {
     if (programId_ != 0) {
         glDeleteProgram(programId_);
@@ -187,6 +238,10 @@ void Shader::setUint(const char* name, unsigned int value) const {
     }
 }
 
+void Shader::dispatch(unsigned int groupsX, unsigned int groupsY, unsigned int groupsZ) const {
+    glDispatchCompute(groupsX, groupsY, groupsZ);
+}
+
 RENDERER_NAMESPACE_END
 
 
@@ -10,8 +10,11 @@ class RENDERER_API Shader
 {
 public:
     Shader(const std::string &vertexSource, const std::string &fragmentSource);
+    // 计算着色器程序
+    explicit Shader(const std::string &computeSource);
     // 从文件路径构造
     static std::shared_ptr<Shader> fromFiles(const std::string &vertexPath, const std::string &fragmentPath);
+    static std::shared_ptr<Shader> fromComputeFile(const std::string &computePath);
 
     ~Shader();
 
@@ -37,12 +40,16 @@ public:
     void setInt2(const char *name, int x, int y) const;
     void setUint(const char *name, unsigned int value) const;
 
+    /// 以当前程序派发计算着色器（调用方负责绑定资源与 glMemoryBarrier）
+    void dispatch(unsigned int groupsX, unsigned int groupsY = 1, unsigned int groupsZ = 1) const;
+
 private:
     unsigned int programId_ = 0;
     mutable std::unordered_map<std::string, int> uniformLocationCache_;
 
     static unsigned int compileStage(int type, const std::string &source);
     static std::string readFile(const std::string &filepath);
+    static std::string readFile(const std::string &filepath, int includeDepth);
     int getUniformLocation(const char* name) const;
 };
 
@@ -47,6 +47,33 @@ std::shared_ptr<Shader> ShaderManager::LoadShader(const std::string& name,
     return nullptr;
 }
 
+std::shared_ptr<Shader> ShaderManager::LoadComputeShader(const std::string& name, const std::string& computePath)
+{
+    auto it = m_shaders.find(name);
+    if (it != m_shaders.end())
+    {
+        LOG_CORE_WARN("Shader '{}' already loaded, returning cached version", name);
+        return it->second;
+    }
+
+    LOG_CORE_INFO("Loading compute shader '{}': cs={}", name, computePath);
+    try
+    {
+        auto shader = Shader::fromComputeFile(computePath);
+        m_shaders[name] = shader;
+        return shader;
+    }
+    catch (const std::exception& e)
+    {
+        LOG_CORE_ERROR("Failed to load shader '{}': {}", name, e.what());
+    }
+    catch (...)
+    {
+        LOG_CORE_ERROR("Failed to load shader '{}': unknown exception", name);
+    }
+    return nullptr;
+}
+
 std::shared_ptr<Shader> ShaderManager::GetShader(const std::string& name) const
 {
     auto it = m_shaders.find(name);
@@ -24,6 +24,9 @@ public:
                                        const std::string& vertexPath,
                                        const std::string& fragmentPath);
 
+    /// 从文件加载计算着色器程序并缓存，缓存规则同 LoadShader
+    std::shared_ptr<Shader> LoadComputeShader(const std::string& name, const std::string& computePath);
+
     /// 按名称获取已加载的 Shader
     std::shared_ptr<Shader> GetShader(const std::string& name) const;
 
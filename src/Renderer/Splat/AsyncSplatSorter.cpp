@@ -0,0 +1,172 @@
+#include "Splat/AsyncSplatSorter.h"
+#include <algorithm>
+#include <cstring>
+
+RENDERER_NAMESPACE_BEGIN
+
+AsyncSplatSorter::AsyncSplatSorter(unsigned int threadCount)
+{
+    if (threadCount == 0)
+        threadCount = std::max(1u, std::thread::hardware_concurrency() / 2);
+
+    m_pool = std::make_unique<ThreadPool>(threadCount);
+    m_sorter = std::make_unique<SplatSorter>(*m_pool);
+    m_worker = std::thread([this]() { WorkerLoop(); });
+}
+
+AsyncSplatSorter::~AsyncSplatSorter()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_requestCondition.notify_all();
+    if (m_worker.joinable())
+        m_worker.join();
+}
+
+void AsyncSplatSorter::SetPositions(const float *const *position, size_t count)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_hasRequest = false;
+    m_stateCondition.wait(lock, [&]() { return !m_sorting; });
+
+    for (int c = 0; c < 3; ++c)
+        m_position[c] = count > 0 ? position[c] : nullptr;
+    m_count = count;
+    // 后台线程空闲，可以安全地丢弃历史排列；旧结果的下标对新数据无意义，发布一个空结果
+    m_sorter->Reset();
+    m_bufferCount[0] = 0;
+    m_bufferCount[1] = 0;
+    ++m_version;
+}
+
+void AsyncSplatSorter::RequestSort(const float *viewMatrix, const uint32_t *indices, size_t indexCount)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        std::memcpy(m_pendingView, viewMatrix, sizeof(m_pendingView));
+        m_pendingUseIndices = indices != nullptr;
+        if (indices)
+            m_pendingIndices.assign(indices, indices + indexCount);
+        m_hasRequest = true;
+    }
+    m_requestCondition.notify_one();
+}
+
+uint64_t AsyncSplatSorter::ConsumeLatest(uint64_t lastVersion, const OrderConsumer &consumer)
+{
+    int front;
+    size_t count;
+    uint64_t version;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_version == lastVersion)
+            return lastVersion;
+        m_reading = true;
+        front = m_frontBuffer;
+        count = m_bufferCount[front];
+        version = m_version;
+    }
+
+    // 读取期间后台线程只会写另一个缓冲，发布前会等待读取结束
+    consumer(m_buffers[front].data(), count);
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_reading = false;
+    }
+    m_stateCondition.notify_all();
+    return version;
+}
+
+void AsyncSplatSorter::WaitIdle()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_stateCondition.wait(lock, [&]() { return !m_hasRequest && !m_sorting; });
+}
+
+uint64_t AsyncSplatSorter::GetPublishedVersion() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_version;
+}
+
+SplatSorter::Stats AsyncSplatSorter::GetLastStats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_lastStats;
+}
+
+void AsyncSplatSorter::SetMode(SplatSorter::Mode mode)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_mode = mode;
+}
+
+void AsyncSplatSorter::WorkerLoop()
+{
+    float view[16];
+    float sortedView[16] = {};
+    const float *position[3];
+    uint64_t sortedVersion = 0;
+    std::vector<uint32_t> indices;
+    bool useIndices = false;
+
+    while (true)
+    {
+        size_t count;
+        uint64_t dataVersion;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_requestCondition.wait(lock, [&]() { return m_stop || m_hasRequest; });
+            if (m_stop)
+                return;
+
+            std::memcpy(view, m_pendingView, sizeof(view));
+            std::copy(m_position, m_position + 3, position);
+            count = m_count;
+            dataVersion = m_version;
+            // 交换而非拷贝，渲染线程下次提交时复用本线程上一次的缓冲
+            useIndices = m_pendingUseIndices;
+            if (useIndices)
+                indices.swap(m_pendingIndices);
+            m_hasRequest = false;
+            m_sorting = true;
+            m_sorter->SetMode(m_mode);
+        }
+
+        // 相机静止且数据未变化时沿用已发布的结果（可见列表由视图决定，视图不变则列表不变）
+        const bool unchanged = sortedVersion == dataVersion && std::memcmp(view, sortedView, sizeof(view)) == 0;
+        if (!unchanged && count > 0)
+        {
+            if (useIndices)
+                m_sorter->Sort(position, count, view, indices.data(), indices.size());
+            else
+                m_sorter->Sort(position, count, view);
+
+            // 后缓冲只由本线程写入，渲染线程只读取前缓冲，无需持锁拷贝
+            const int back = 1 - m_frontBuffer;
+            const std::vector<uint32_t> &order = m_sorter->GetOrder();
+            m_buffers[back].assign(order.begin(), order.end());
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (!unchanged && count > 0)
+            {
+                m_stateCondition.wait(lock, [&]() { return !m_reading; });
+                const int back = 1 - m_frontBuffer;
+                m_bufferCount[back] = m_buffers[back].size();
+                m_frontBuffer = back;
+                m_lastStats = m_sorter->GetStats();
+                sortedVersion = ++m_version;
+                std::memcpy(sortedView, view, sizeof(view));
+            }
+            m_sorting = false;
+        }
+        m_stateCondition.notify_all();
+    }
+}
+
+RENDERER_NAMESPACE_END
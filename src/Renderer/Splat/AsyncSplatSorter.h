@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Core/RenderCore.h"
+#include "Core/ThreadPool.h"
+#include "Splat/SplatSorter.h"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+RENDERER_NAMESPACE_BEGIN
+
+/// 后台线程上的双缓冲高斯排序
+///
+/// 渲染线程每帧调用 RequestSort 提交最新相机位姿（只拷贝矩阵，不阻塞），后台线程对最近一次的位姿快照排序，
+/// 完成后写入两个索引缓冲中未被读取的一个并发布。渲染线程通过 ConsumeLatest 取用最新完成的顺序，
+/// 因此帧率不再受排序耗时限制，排序延迟只会带来短暂的轻微顺序误差。
+/// 排序使用独立线程池，不与渲染线程上 ThreadPool::Global() 的并行任务互相阻塞。
+class RENDERER_API AsyncSplatSorter
+{
+public:
+    /// 排序结果的使用者：order 为从后往前的高斯下标，仅在回调期间有效
+    using OrderConsumer = std::function<void(const uint32_t *order, size_t count)>;
+
+    /// @param threadCount 排序线程池的线程数（含后台排序线程本身），0 表示使用一半硬件并发数
+    explicit AsyncSplatSorter(unsigned int threadCount = 0);
+    ~AsyncSplatSorter();
+
+    AsyncSplatSorter(const AsyncSplatSorter &) = delete;
+    AsyncSplatSorter &operator=(const AsyncSplatSorter &) = delete;
+
+    /// 设置待排序的位置数据（x, y, z 三个平面，须在下次 SetPositions 或析构前保持有效）
+    /// 会等待进行中的排序结束并丢弃已发布的结果
+    void SetPositions(const float *const *position, size_t count);
+
+    /// 提交列主序视图矩阵；后台线程尚未取走的旧请求会被覆盖
+    /// @param indices 可选的参与排序的高斯下标（如 SplatCuller 的可见列表，会被拷贝），为空时排序全部高斯
+    void RequestSort(const float *viewMatrix, const uint32_t *indices = nullptr, size_t indexCount = 0);
+
+    /// 若已发布的结果比 lastVersion 新，在读取期间调用 consumer（期间该缓冲不会被改写）
+    /// @return 当前已消费的版本号；没有新结果时原样返回 lastVersion
+    uint64_t ConsumeLatest(uint64_t lastVersion, const OrderConsumer &consumer);
+
+    /// 阻塞直到没有待处理或进行中的排序
+    void WaitIdle();
+
+    /// 已发布结果的版本号，0 表示尚无结果
+    uint64_t GetPublishedVersion() const;
+    /// 最近一次后台排序的统计
+    SplatSorter::Stats GetLastStats() const;
+    void SetMode(SplatSorter::Mode mode);
+
+private:
+    void WorkerLoop();
+
+    std::unique_ptr<ThreadPool> m_pool;
+    std::unique_ptr<SplatSorter> m_sorter; // 仅后台线程访问（SetPositions 在空闲时重置）
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_requestCondition;
+    std::condition_variable m_stateCondition;
+    std::thread m_worker;
+
+    // 以下受 m_mutex 保护
+    const float *m_position[3] = {nullptr, nullptr, nullptr};
+    size_t m_count = 0;
+    float m_pendingView[16] = {};
+    std::vector<uint32_t> m_pendingIndices;
+    bool m_pendingUseIndices = false;
+    bool m_hasRequest = false;
+    bool m_sorting = false;
+    bool m_reading = false;
+    bool m_stop = false;
+    std::vector<uint32_t> m_buffers[2];
+    size_t m_bufferCount[2] = {0, 0};
+    int m_frontBuffer = 0;
+    uint64_t m_version = 0;
+    SplatSorter::Stats m_lastStats;
+    SplatSorter::Mode m_mode = SplatSorter::Mode::Incremental;
+};
+
+RENDERER_NAMESPACE_END
@@ -0,0 +1,321 @@
+#include "Splat/CompressedGaussianCloud.h"
+#include "Core/ThreadPool.h"
+#include "MathUtils/Covariance.h"
+#include "MathUtils/HalfFloat.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+RENDERER_NAMESPACE_BEGIN
+
+namespace
+{
+// 每个并行任务处理的块数
+const size_t COMPRESS_GRAIN_CHUNKS = 16;
+const float SQRT2 = 1.41421356f;
+// 块内范围过小时的最小跨度，避免除零
+const float MIN_RANGE = 1e-8f;
+
+inline uint32_t QuantizeUnorm(float value, float minValue, float maxValue, uint32_t maxCode)
+{
+    float t = (value - minValue) / std::max(maxValue - minValue, MIN_RANGE);
+    t = std::min(std::max(t, 0.0f), 1.0f);
+    return static_cast<uint32_t>(std::lround(t * static_cast<float>(maxCode)));
+}
+
+inline float DequantizeUnorm(uint32_t code, float minValue, float maxValue, uint32_t maxCode)
+{
+    return minValue + (maxValue - minValue) * (static_cast<float>(code) / static_cast<float>(maxCode));
+}
+
+// smallest-three：丢弃绝对值最大的分量（翻转符号使其为正），其余三个分量落在 [-1/√2, 1/√2]
+uint32_t PackQuaternion(const float *q)
+{
+    int largest = 0;
+    for (int c = 1; c < 4; ++c)
+    {
+        if (std::fabs(q[c]) > std::fabs(q[largest]))
+            largest = c;
+    }
+    const float sign = q[largest] < 0.0f ? -1.0f : 1.0f;
+
+    uint32_t packed = static_cast<uint32_t>(largest) << 30;
+    int shift = 0;
+    for (int c = 0; c < 4; ++c)
+    {
+        if (c == largest)
+            continue;
+        float v = q[c] * sign * SQRT2 * 0.5f + 0.5f;
+        packed |= QuantizeUnorm(v, 0.0f, 1.0f, 1023u) << shift;
+        shift += 10;
+    }
+    return packed;
+}
+
+void UnpackQuaternion(uint32_t packed, float *q)
+{
+    const int largest = static_cast<int>(packed >> 30);
+    float sumSquares = 0.0f;
+    int shift = 0;
+    for (int c = 0; c < 4; ++c)
+    {
+        if (c == largest)
+            continue;
+        float v = (DequantizeUnorm((packed >> shift) & 1023u, 0.0f, 1.0f, 1023u) - 0.5f) * SQRT2;
+        q[c] = v;
+        sumSquares += v * v;
+        shift += 10;
+    }
+    q[largest] = std::sqrt(std::max(0.0f, 1.0f - sumSquares));
+}
+
+// 第 i 个高斯的第 j 个球谐系数（j = k * 3 + channel）
+inline float GetSHCoeff(const GaussianCloud &cloud, size_t i, int j, int restCoeffs)
+{
+    const int k = j / 3;
+    const int channel = j % 3;
+    if (k == 0)
+        return cloud.GetComponent(GaussianCloud::Attribute::SHDC, channel)[i];
+    return cloud.GetComponent(GaussianCloud::Attribute::SHRest, channel * restCoeffs + k - 1)[i];
+}
+
+inline float *GetSHCoeff(GaussianCloud &cloud, size_t i, int j, int restCoeffs)
+{
+    const int k = j / 3;
+    const int channel = j % 3;
+    if (k == 0)
+        return cloud.GetComponent(GaussianCloud::Attribute::SHDC, channel) + i;
+    return cloud.GetComponent(GaussianCloud::Attribute::SHRest, channel * restCoeffs + k - 1) + i;
+}
+} // namespace
+
+CompressedGaussianCloud::CompressedGaussianCloud()
+{
+}
+
+CompressedGaussianCloud::~CompressedGaussianCloud()
+{
+}
+
+void CompressedGaussianCloud::Compress(const GaussianCloud &cloud, SHEncoding shEncoding,
+                                       const std::shared_ptr<const SHCodebook> &shCodebook)
+{
+    m_count = cloud.GetCount();
+    m_shDegree = cloud.GetSHDegree();
+    m_shEncoding = shEncoding;
+    m_shCodebook.reset();
+    if (shCodebook && shCodebook->GetCount() == m_count && shCodebook->GetSHDegree() == m_shDegree &&
+        shCodebook->GetEntryCount() > 0)
+        m_shCodebook = shCodebook;
+
+    const unsigned int coeffsPerWord = shEncoding == SHEncoding::UInt8 ? 4u : 2u;
+    m_shWordsPerSplat = (static_cast<unsigned int>(GetSHCoeffCount()) + coeffsPerWord - 1) / coeffsPerWord;
+
+    const size_t chunkCount = (m_count + CHUNK_SIZE - 1) / CHUNK_SIZE;
+    m_splats.assign(m_count * SPLAT_WORDS, 0u);
+    m_chunks.assign(chunkCount * CHUNK_FLOATS, 0.0f);
+    m_sh.assign(m_count * m_shWordsPerSplat, 0u);
+
+    ThreadPool::Global().ParallelFor(0, chunkCount, COMPRESS_GRAIN_CHUNKS, [&](size_t begin, size_t end, unsigned int) {
+        for (size_t chunk = begin; chunk < end; ++chunk)
+            CompressChunk(cloud, chunk);
+    });
+}
+
+void CompressedGaussianCloud::CompressChunk(const GaussianCloud &cloud, size_t chunk)
+{
+    using Attribute = GaussianCloud::Attribute;
+    const size_t first = chunk * CHUNK_SIZE;
+    const size_t last = std::min(first + CHUNK_SIZE, m_count);
+    const int restCoeffs = GaussianCloud::GetSHRestCoeffCount(m_shDegree);
+    const int shCoeffs = GetSHCoeffCount();
+
+    // 1. 统计块内量化范围
+    float posMin[3], posMax[3], logScaleMin[3], logScaleMax[3];
+    for (int c = 0; c < 3; ++c)
+    {
+        posMin[c] = logScaleMin[c] = std::numeric_limits<float>::max();
+        posMax[c] = logScaleMax[c] = std::numeric_limits<float>::lowest();
+    }
+    float dcMin = std::numeric_limits<float>::max(), dcMax = std::numeric_limits<float>::lowest();
+    float restMin = 0.0f, restMax = 0.0f;
+    const int inlineRestCoeffs = m_shCodebook ? 0 : restCoeffs;
+    if (inlineRestCoeffs > 0)
+    {
+        restMin = std::numeric_limits<float>::max();
+        restMax = std::numeric_limits<float>::lowest();
+    }
+
+    for (int c = 0; c < 3; ++c)
+    {
+        const float *pos = cloud.GetComponent(Attribute::Position, c);
+        const float *scale = cloud.GetComponent(Attribute::Scale, c);
+        const float *dc = cloud.GetComponent(Attribute::SHDC, c);
+        for (size_t i = first; i < last; ++i)
+        {
+            posMin[c] = std::min(posMin[c], pos[i]);
+            posMax[c] = std::max(posMax[c], pos[i]);
+            const float logScale = std::log(std::max(scale[i], MIN_RANGE));
+            logScaleMin[c] = std::min(logScaleMin[c], logScale);
+            logScaleMax[c] = std::max(logScaleMax[c], logScale);
+            dcMin = std::min(dcMin, dc[i]);
+            dcMax = std::max(dcMax, dc[i]);
+        }
+    }
+    for (int comp = 0; comp < inlineRestCoeffs * 3; ++comp)
+    {
+        const float *rest = cloud.GetComponent(Attribute::SHRest, comp);
+        for (size_t i = first; i < last; ++i)
+        {
+            restMin = std::min(restMin, rest[i]);
+            restMax = std::max(restMax, rest[i]);
+        }
+    }
+
+    float *chunkData = &m_chunks[chunk * CHUNK_FLOATS];
+    for (int c = 0; c < 3; ++c)
+    {
+        chunkData[0 + c] = posMin[c];
+        chunkData[3 + c] = posMax[c];
+        chunkData[6 + c] = logScaleMin[c];
+        chunkData[9 + c] = logScaleMax[c];
+    }
+    chunkData[12] = dcMin;
+    chunkData[13] = dcMax;
+    chunkData[14] = restMin;
+    chunkData[15] = restMax;
+
+    // 2. 逐高斯编码
+    const float *pos[3], *scale[3], *rot[4];
+    for (int c = 0; c < 3; ++c)
+    {
+        pos[c] = cloud.GetComponent(Attribute::Position, c);
+        scale[c] = cloud.GetComponent(Attribute::Scale, c);
+    }
+    for (int c = 0; c < 4; ++c)
+        rot[c] = cloud.GetComponent(Attribute::Rotation, c);
+    const float *opacity = cloud.GetAttribute(Attribute::Opacity);
+
+    for (size_t i = first; i < last; ++i)
+    {
+        uint32_t *splat = &m_splats[i * SPLAT_WORDS];
+        const uint32_t px = QuantizeUnorm(pos[0][i], posMin[0], posMax[0], 65535u);
+        const uint32_t py = QuantizeUnorm(pos[1][i], posMin[1], posMax[1], 65535u);
+        const uint32_t pz = QuantizeUnorm(pos[2][i], posMin[2], posMax[2], 65535u);
+        splat[0] = px | (py << 16);
+        splat[1] = pz | (m_shCodebook ? static_cast<uint32_t>(m_shCodebook->GetIndex(i)) << 16 : 0u);
+
+        const float q[4] = {rot[0][i], rot[1][i], rot[2][i], rot[3][i]};
+        splat[2] = PackQuaternion(q);
+
+        uint32_t scaleOpacity = QuantizeUnorm(opacity[i], 0.0f, 1.0f, 255u) << 24;
+        for (int c = 0; c < 3; ++c)
+        {
+            const float logScale = std::log(std::max(scale[c][i], MIN_RANGE));
+            scaleOpacity |= QuantizeUnorm(logScale, logScaleMin[c], logScaleMax[c], 255u) << (c * 8);
+        }
+        splat[3] = scaleOpacity;
+
+        uint32_t *sh = &m_sh[i * m_shWordsPerSplat];
+        for (int j = 0; j < shCoeffs; ++j)
+        {
+            const float value = GetSHCoeff(cloud, i, j, restCoeffs);
+            if (m_shEncoding == SHEncoding::UInt8)
+            {
+                const uint32_t code = j < 3 ? QuantizeUnorm(value, dcMin, dcMax, 255u)
+                                            : QuantizeUnorm(value, restMin, restMax, 255u);
+                sh[j / 4] |= code << ((j % 4) * 8);
+            }
+            else
+            {
+                sh[j / 2] |= static_cast<uint32_t>(floatToHalf(value)) << ((j % 2) * 16);
+            }
+        }
+    }
+}
+
+void CompressedGaussianCloud::Decompress(GaussianCloud &cloud) const
+{
+    using Attribute = GaussianCloud::Attribute;
+    cloud.Allocate(m_count, m_shDegree);
+    const int restCoeffs = GaussianCloud::GetSHRestCoeffCount(m_shDegree);
+    const int shCoeffs = GetSHCoeffCount();
+
+    float *pos[3], *scale[3], *rot[4], *cov[6];
+    for (int c = 0; c < 3; ++c)
+    {
+        pos[c] = cloud.GetComponent(Attribute::Position, c);
+        scale[c] = cloud.GetComponent(Attribute::Scale, c);
+    }
+    for (int c = 0; c < 4; ++c)
+        rot[c] = cloud.GetComponent(Attribute::Rotation, c);
+    for (int c = 0; c < 6; ++c)
+        cov[c] = cloud.GetComponent(Attribute::Covariance, c);
+    float *opacity = cloud.GetAttribute(Attribute::Opacity);
+
+    ThreadPool::Global().ParallelFor(0, GetChunkCount(), COMPRESS_GRAIN_CHUNKS, [&](size_t begin, size_t end,
+                                                                                    unsigned int) {
+        for (size_t chunk = begin; chunk < end; ++chunk)
+        {
+            const float *chunkData = &m_chunks[chunk * CHUNK_FLOATS];
+            const size_t first = chunk * CHUNK_SIZE;
+            const size_t last = std::min(first + CHUNK_SIZE, m_count);
+            for (size_t i = first; i < last; ++i)
+            {
+                const uint32_t *splat = &m_splats[i * SPLAT_WORDS];
+                const uint32_t posCodes[3] = {splat[0] & 0xffffu, splat[0] >> 16, splat[1] & 0xffffu};
+                for (int c = 0; c < 3; ++c)
+                {
+                    pos[c][i] = DequantizeUnorm(posCodes[c], chunkData[c], chunkData[3 + c], 65535u);
+                    const uint32_t scaleCode = (splat[3] >> (c * 8)) & 0xffu;
+                    scale[c][i] = std::exp(DequantizeUnorm(scaleCode, chunkData[6 + c], chunkData[9 + c], 255u));
+                }
+                opacity[i] = DequantizeUnorm(splat[3] >> 24, 0.0f, 1.0f, 255u);
+
+                float q[4];
+                UnpackQuaternion(splat[2], q);
+                for (int c = 0; c < 4; ++c)
+                    rot[c][i] = q[c];
+
+                const uint32_t *sh = &m_sh[i * m_shWordsPerSplat];
+                for (int j = 0; j < shCoeffs; ++j)
+                {
+                    float value;
+                    if (m_shEncoding == SHEncoding::UInt8)
+                    {
+                        const uint32_t code = (sh[j / 4] >> ((j % 4) * 8)) & 0xffu;
+                        value = j < 3 ? DequantizeUnorm(code, chunkData[12], chunkData[13], 255u)
+                                      : DequantizeUnorm(code, chunkData[14], chunkData[15], 255u);
+                    }
+                    else
+                    {
+                        value = halfToFloat(static_cast<uint16_t>((sh[j / 2] >> ((j % 2) * 16)) & 0xffffu));
+                    }
+                    *GetSHCoeff(cloud, i, j, restCoeffs) = value;
+                }
+                if (m_shCodebook)
+                {
+                    const float *entry = m_shCodebook->GetEntry(splat[1] >> 16);
+                    for (int j = 3; j < 3 + restCoeffs * 3; ++j)
+                        *GetSHCoeff(cloud, i, j, restCoeffs) = entry[j - 3];
+                }
+            }
+            CovarianceUtils::compute3DCovarianceBatch(scale, rot, cov, first, last);
+        }
+    });
+
+    // 包围盒取各块位置范围的并集
+    float boundsMin[3] = {0.0f, 0.0f, 0.0f}, boundsMax[3] = {0.0f, 0.0f, 0.0f};
+    for (size_t chunk = 0; chunk < GetChunkCount(); ++chunk)
+    {
+        const float *chunkData = &m_chunks[chunk * CHUNK_FLOATS];
+        for (int c = 0; c < 3; ++c)
+        {
+            boundsMin[c] = chunk == 0 ? chunkData[c] : std::min(boundsMin[c], chunkData[c]);
+            boundsMax[c] = chunk == 0 ? chunkData[3 + c] : std::max(boundsMax[c], chunkData[3 + c]);
+        }
+    }
+    cloud.SetBounds(boundsMin, boundsMax);
+}
+
+RENDERER_NAMESPACE_END
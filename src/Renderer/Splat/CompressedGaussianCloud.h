@@ -0,0 +1,133 @@
+#pragma once
+
+#include "Core/RenderCore.h"
+#include "Splat/GaussianCloud.h"
+#include "Splat/SHCodebook.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+RENDERER_NAMESPACE_BEGIN
+
+/// 量化压缩的高斯点云（CPU 与 GPU 共用同一布局，顶点着色器中反量化）
+///
+/// 高斯按 CHUNK_SIZE 个一组划分块，每块记录量化范围（CHUNK_FLOATS 个 float）：
+///   [0..2] 位置最小值  [3..5] 位置最大值  [6..8] log(scale) 最小值  [9..11] log(scale) 最大值
+///   [12..13] SH DC 范围  [14..15] SH rest 范围（仅 8 位编码使用）
+///
+/// 每个高斯的主体数据为 4 个 uint（16 字节）：
+///   word0: pos.x(16) | pos.y(16) << 16        位置相对块包围盒归一化到 16 位
+///   word1: pos.z(16) | SH 码字下标(16) << 16（仅使用码本时有效）
+///   word2: 四元数 smallest-three 10/10/10/2：三个较小分量各 10 位，最大分量下标 2 位
+///   word3: log(sx)(8) | log(sy)(8) << 8 | log(sz)(8) << 16 | opacity(8) << 24
+///
+/// 球谐系数单独存放，每个高斯占 GetSHWordsPerSplat() 个 uint，
+/// 系数顺序为 j = k * 3 + channel（k = 0 为 DC），按 SHEncoding 编码为 fp16 或块内归一化的 8 位。
+/// 若提供 SHCodebook，则每个高斯只内联存储 DC，高阶系数通过 word1 中的码字下标从码本读取
+/// 着色器端解码见 res/shaders/splat_compressed.glsl
+class RENDERER_API CompressedGaussianCloud
+{
+public:
+    enum class SHEncoding
+    {
+        Float16 = 0,
+        UInt8 = 1
+    };
+
+    static constexpr size_t CHUNK_SIZE = 256;
+    static constexpr int CHUNK_FLOATS = 16;
+    static constexpr int SPLAT_WORDS = 4;
+
+    CompressedGaussianCloud();
+    ~CompressedGaussianCloud();
+
+    CompressedGaussianCloud(const CompressedGaussianCloud &) = delete;
+    CompressedGaussianCloud &operator=(const CompressedGaussianCloud &) = delete;
+
+    /// 量化整个点云（按块并行）
+    /// @param shCodebook 可选的 f_rest 码本（须由同一点云构建），提供时高阶系数不再逐高斯存储
+    void Compress(const GaussianCloud &cloud, SHEncoding shEncoding = SHEncoding::UInt8,
+                  const std::shared_ptr<const SHCodebook> &shCodebook = nullptr);
+    /// 反量化为 fp32 SoA 点云（同时重算协方差），供 CPU 端处理或误差校验
+    void Decompress(GaussianCloud &cloud) const;
+
+    size_t GetCount() const
+    {
+        return m_count;
+    }
+    size_t GetChunkCount() const
+    {
+        return m_chunks.size() / CHUNK_FLOATS;
+    }
+    int GetSHDegree() const
+    {
+        return m_shDegree;
+    }
+    SHEncoding GetSHEncoding() const
+    {
+        return m_shEncoding;
+    }
+    /// 每个高斯内联存储的球谐系数个数（含 DC，三通道合计；使用码本时仅为 DC 的 3 个）
+    int GetSHCoeffCount() const
+    {
+        return m_shCodebook ? 3 : 3 * (m_shDegree + 1) * (m_shDegree + 1);
+    }
+    /// 高阶球谐码本，未使用时为空
+    const std::shared_ptr<const SHCodebook> &GetSHCodebook() const
+    {
+        return m_shCodebook;
+    }
+    /// 每个高斯的球谐数据占用的 uint 个数
+    unsigned int GetSHWordsPerSplat() const
+    {
+        return m_shWordsPerSplat;
+    }
+
+    // ---- GPU 上传用的原始数据 ----
+    const uint32_t *GetSplatData() const
+    {
+        return m_splats.data();
+    }
+    size_t GetSplatDataSize() const
+    {
+        return m_splats.size() * sizeof(uint32_t);
+    }
+    const float *GetChunkData() const
+    {
+        return m_chunks.data();
+    }
+    size_t GetChunkDataSize() const
+    {
+        return m_chunks.size() * sizeof(float);
+    }
+    const uint32_t *GetSHData() const
+    {
+        return m_sh.data();
+    }
+    size_t GetSHDataSize() const
+    {
+        return m_sh.size() * sizeof(uint32_t);
+    }
+
+    /// 压缩后总字节数（含码本）
+    size_t GetMemorySize() const
+    {
+        return GetSplatDataSize() + GetChunkDataSize() + GetSHDataSize() +
+               (m_shCodebook ? m_shCodebook->GetEntryDataSize() : 0);
+    }
+
+private:
+    void CompressChunk(const GaussianCloud &cloud, size_t chunk);
+
+    std::vector<uint32_t> m_splats;
+    std::vector<float> m_chunks;
+    std::vector<uint32_t> m_sh;
+    std::shared_ptr<const SHCodebook> m_shCodebook;
+    size_t m_count = 0;
+    int m_shDegree = 0;
+    unsigned int m_shWordsPerSplat = 0;
+    SHEncoding m_shEncoding = SHEncoding::UInt8;
+};
+
+RENDERER_NAMESPACE_END
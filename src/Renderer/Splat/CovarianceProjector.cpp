@@ -0,0 +1,336 @@
+#include "Splat/CovarianceProjector.h"
+#include <algorithm>
+#include <cmath>
+
+#if RENDERER_ARCH_X86
+#include <immintrin.h>
+#endif
+
+RENDERER_NAMESPACE_BEGIN
+
+namespace
+{
+using ViewConstants = CovarianceProjector::ViewConstants;
+
+// 低通滤波：保证每个高斯在屏幕上至少覆盖约一个像素
+const float LOW_PASS = 0.3f;
+// 特征值判别式下限（与 3DGS 参考实现一致）
+const float MIN_DISCRIMINANT = 0.1f;
+
+// ---- 标量内核：兼作 SIMD 路径的尾部处理 ----
+inline void ProjectOne(const ViewConstants &v, const float *const *pos, const float *const *cov, size_t i,
+                       const SplatProjectionOutput &out)
+{
+    const float px = pos[0][i], py = pos[1][i], pz = pos[2][i];
+    float tx = v.w[0] * px + v.w[1] * py + v.w[2] * pz + v.t[0];
+    float ty = v.w[3] * px + v.w[4] * py + v.w[5] * pz + v.t[1];
+    const float z = -(v.w[6] * px + v.w[7] * py + v.w[8] * pz + v.t[2]);
+    out.depth[i] = z;
+
+    if (!(z > v.nearClip))
+    {
+        out.cov2D[0][i] = out.cov2D[1][i] = out.cov2D[2][i] = 0.0f;
+        out.conic[0][i] = out.conic[1][i] = out.conic[2][i] = 0.0f;
+        out.radius[i] = 0.0f;
+        if (out.mean2D[0])
+            out.mean2D[0][i] = out.mean2D[1][i] = 0.0f;
+        return;
+    }
+
+    const float invZ = 1.0f / z;
+    if (out.mean2D[0])
+    {
+        out.mean2D[0][i] = v.focalX * tx * invZ + v.cx;
+        out.mean2D[1][i] = v.focalY * ty * invZ + v.cy;
+    }
+    tx = std::min(std::max(tx * invZ, -v.limX), v.limX) * z;
+    ty = std::min(std::max(ty * invZ, -v.limY), v.limY) * z;
+
+    // J 的非零项；T = J·W 的两行
+    const float j00 = v.focalX * invZ;
+    const float j02 = v.focalX * tx * invZ * invZ;
+    const float j11 = v.focalY * invZ;
+    const float j12 = v.focalY * ty * invZ * invZ;
+    const float t0x = j00 * v.w[0] + j02 * v.w[6];
+    const float t0y = j00 * v.w[1] + j02 * v.w[7];
+    const float t0z = j00 * v.w[2] + j02 * v.w[8];
+    const float t1x = j11 * v.w[3] + j12 * v.w[6];
+    const float t1y = j11 * v.w[4] + j12 * v.w[7];
+    const float t1z = j11 * v.w[5] + j12 * v.w[8];
+
+    const float cxx = cov[0][i], cxy = cov[1][i], cxz = cov[2][i];
+    const float cyy = cov[3][i], cyz = cov[4][i], czz = cov[5][i];
+    const float s0x = cxx * t0x + cxy * t0y + cxz * t0z;
+    const float s0y = cxy * t0x + cyy * t0y + cyz * t0z;
+    const float s0z = cxz * t0x + cyz * t0y + czz * t0z;
+    const float s1x = cxx * t1x + cxy * t1y + cxz * t1z;
+    const float s1y = cxy * t1x + cyy * t1y + cyz * t1z;
+    const float s1z = cxz * t1x + cyz * t1y + czz * t1z;
+
+    const float a = t0x * s0x + t0y * s0y + t0z * s0z + LOW_PASS;
+    const float b = t1x * s0x + t1y * s0y + t1z * s0z;
+    const float c = t1x * s1x + t1y * s1y + t1z * s1z + LOW_PASS;
+    out.cov2D[0][i] = a;
+    out.cov2D[1][i] = b;
+    out.cov2D[2][i] = c;
+
+    const float det = a * c - b * b;
+    if (!(det > 0.0f))
+    {
+        out.conic[0][i] = out.conic[1][i] = out.conic[2][i] = 0.0f;
+        out.radius[i] = 0.0f;
+        return;
+    }
+    const float invDet = 1.0f / det;
+    out.conic[0][i] = c * invDet;
+    out.conic[1][i] = -b * invDet;
+    out.conic[2][i] = a * invDet;
+
+    const float mid = 0.5f * (a + c);
+    const float lambda = mid + std::sqrt(std::max(MIN_DISCRIMINANT, mid * mid - det));
+    out.radius[i] = std::ceil(3.0f * std::sqrt(lambda));
+}
+
+void ProjectScalar(const ViewConstants &v, const float *const *pos, const float *const *cov, size_t begin,
+                   size_t end, const SplatProjectionOutput &out)
+{
+    for (size_t i = begin; i < end; ++i)
+        ProjectOne(v, pos, cov, i, out);
+}
+
+#if RENDERER_ARCH_X86
+
+// ---- SSE4.1 内核：每次迭代 2 组 x 4 路 ----
+RENDERER_TARGET_SSE41 inline void ProjectSSE4(const ViewConstants &v, const float *const *pos,
+                                               const float *const *cov, size_t i, const SplatProjectionOutput &out)
+{
+    const __m128 w0 = _mm_set1_ps(v.w[0]), w1 = _mm_set1_ps(v.w[1]), w2 = _mm_set1_ps(v.w[2]);
+    const __m128 w3 = _mm_set1_ps(v.w[3]), w4 = _mm_set1_ps(v.w[4]), w5 = _mm_set1_ps(v.w[5]);
+    const __m128 w6 = _mm_set1_ps(v.w[6]), w7 = _mm_set1_ps(v.w[7]), w8 = _mm_set1_ps(v.w[8]);
+    const __m128 zero = _mm_setzero_ps();
+
+    const __m128 px = _mm_loadu_ps(pos[0] + i), py = _mm_loadu_ps(pos[1] + i), pz = _mm_loadu_ps(pos[2] + i);
+    __m128 tx = _mm_add_ps(_mm_add_ps(_mm_mul_ps(w0, px), _mm_mul_ps(w1, py)),
+                           _mm_add_ps(_mm_mul_ps(w2, pz), _mm_set1_ps(v.t[0])));
+    __m128 ty = _mm_add_ps(_mm_add_ps(_mm_mul_ps(w3, px), _mm_mul_ps(w4, py)),
+                           _mm_add_ps(_mm_mul_ps(w5, pz), _mm_set1_ps(v.t[1])));
+    const __m128 z = _mm_sub_ps(zero, _mm_add_ps(_mm_add_ps(_mm_mul_ps(w6, px), _mm_mul_ps(w7, py)),
+                                                 _mm_add_ps(_mm_mul_ps(w8, pz), _mm_set1_ps(v.t[2]))));
+    _mm_storeu_ps(out.depth + i, z);
+    const __m128 inFront = _mm_cmpgt_ps(z, _mm_set1_ps(v.nearClip));
+
+    const __m128 invZ = _mm_div_ps(_mm_set1_ps(1.0f), z);
+    const __m128 fx = _mm_set1_ps(v.focalX), fy = _mm_set1_ps(v.focalY);
+    if (out.mean2D[0])
+    {
+        const __m128 mx = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(fx, tx), invZ), _mm_set1_ps(v.cx));
+        const __m128 my = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(fy, ty), invZ), _mm_set1_ps(v.cy));
+        _mm_storeu_ps(out.mean2D[0] + i, _mm_and_ps(mx, inFront));
+        _mm_storeu_ps(out.mean2D[1] + i, _mm_and_ps(my, inFront));
+    }
+    const __m128 limX = _mm_set1_ps(v.limX), limY = _mm_set1_ps(v.limY);
+    tx = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_mul_ps(tx, invZ), _mm_sub_ps(zero, limX)), limX), z);
+    ty = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_mul_ps(ty, invZ), _mm_sub_ps(zero, limY)), limY), z);
+
+    const __m128 invZ2 = _mm_mul_ps(invZ, invZ);
+    const __m128 j00 = _mm_mul_ps(fx, invZ);
+    const __m128 j02 = _mm_mul_ps(_mm_mul_ps(fx, tx), invZ2);
+    const __m128 j11 = _mm_mul_ps(fy, invZ);
+    const __m128 j12 = _mm_mul_ps(_mm_mul_ps(fy, ty), invZ2);
+    const __m128 t0x = _mm_add_ps(_mm_mul_ps(j00, w0), _mm_mul_ps(j02, w6));
+    const __m128 t0y = _mm_add_ps(_mm_mul_ps(j00, w1), _mm_mul_ps(j02, w7));
+    const __m128 t0z = _mm_add_ps(_mm_mul_ps(j00, w2), _mm_mul_ps(j02, w8));
+    const __m128 t1x = _mm_add_ps(_mm_mul_ps(j11, w3), _mm_mul_ps(j12, w6));
+    const __m128 t1y = _mm_add_ps(_mm_mul_ps(j11, w4), _mm_mul_ps(j12, w7));
+    const __m128 t1z = _mm_add_ps(_mm_mul_ps(j11, w5), _mm_mul_ps(j12, w8));
+
+    const __m128 cxx = _mm_loadu_ps(cov[0] + i), cxy = _mm_loadu_ps(cov[1] + i), cxz = _mm_loadu_ps(cov[2] + i);
+    const __m128 cyy = _mm_loadu_ps(cov[3] + i), cyz = _mm_loadu_ps(cov[4] + i), czz = _mm_loadu_ps(cov[5] + i);
+#define SSE_DOT3(ax, ay, az, bx, by, bz)                                                                          \
+    _mm_add_ps(_mm_add_ps(_mm_mul_ps(ax, bx), _mm_mul_ps(ay, by)), _mm_mul_ps(az, bz))
+    const __m128 s0x = SSE_DOT3(cxx, cxy, cxz, t0x, t0y, t0z);
+    const __m128 s0y = SSE_DOT3(cxy, cyy, cyz, t0x, t0y, t0z);
+    const __m128 s0z = SSE_DOT3(cxz, cyz, czz, t0x, t0y, t0z);
+    const __m128 s1x = SSE_DOT3(cxx, cxy, cxz, t1x, t1y, t1z);
+    const __m128 s1y = SSE_DOT3(cxy, cyy, cyz, t1x, t1y, t1z);
+    const __m128 s1z = SSE_DOT3(cxz, cyz, czz, t1x, t1y, t1z);
+
+    const __m128 lowPass = _mm_set1_ps(LOW_PASS);
+    const __m128 a = _mm_add_ps(SSE_DOT3(t0x, t0y, t0z, s0x, s0y, s0z), lowPass);
+    const __m128 b = SSE_DOT3(t1x, t1y, t1z, s0x, s0y, s0z);
+    const __m128 c = _mm_add_ps(SSE_DOT3(t1x, t1y, t1z, s1x, s1y, s1z), lowPass);
+#undef SSE_DOT3
+
+    const __m128 det = _mm_sub_ps(_mm_mul_ps(a, c), _mm_mul_ps(b, b));
+    const __m128 valid = _mm_and_ps(inFront, _mm_cmpgt_ps(det, zero));
+    const __m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), det);
+
+    const __m128 mid = _mm_mul_ps(_mm_set1_ps(0.5f), _mm_add_ps(a, c));
+    const __m128 disc = _mm_max_ps(_mm_set1_ps(MIN_DISCRIMINANT), _mm_sub_ps(_mm_mul_ps(mid, mid), det));
+    const __m128 lambda = _mm_add_ps(mid, _mm_sqrt_ps(disc));
+    const __m128 radius = _mm_ceil_ps(_mm_mul_ps(_mm_set1_ps(3.0f), _mm_sqrt_ps(lambda)));
+
+    _mm_storeu_ps(out.cov2D[0] + i, _mm_and_ps(a, inFront));
+    _mm_storeu_ps(out.cov2D[1] + i, _mm_and_ps(b, inFront));
+    _mm_storeu_ps(out.cov2D[2] + i, _mm_and_ps(c, inFront));
+    _mm_storeu_ps(out.conic[0] + i, _mm_and_ps(_mm_mul_ps(c, invDet), valid));
+    _mm_storeu_ps(out.conic[1] + i, _mm_and_ps(_mm_sub_ps(zero, _mm_mul_ps(b, invDet)), valid));
+    _mm_storeu_ps(out.conic[2] + i, _mm_and_ps(_mm_mul_ps(a, invDet), valid));
+    _mm_storeu_ps(out.radius + i, _mm_and_ps(radius, valid));
+}
+
+RENDERER_TARGET_SSE41 void ProjectBatchSSE4(const ViewConstants &v, const float *const *pos,
+                                             const float *const *cov, size_t begin, size_t end,
+                                             const SplatProjectionOutput &out)
+{
+    size_t i = begin;
+    for (; i + 8 <= end; i += 8)
+    {
+        ProjectSSE4(v, pos, cov, i, out);
+        ProjectSSE4(v, pos, cov, i + 4, out);
+    }
+    for (; i + 4 <= end; i += 4)
+        ProjectSSE4(v, pos, cov, i, out);
+    ProjectScalar(v, pos, cov, i, end, out);
+}
+
+// ---- AVX2 内核：每次迭代 8 路 ----
+RENDERER_TARGET_AVX2 void ProjectBatchAVX2(const ViewConstants &v, const float *const *pos,
+                                            const float *const *cov, size_t begin, size_t end,
+                                            const SplatProjectionOutput &out)
+{
+    const __m256 w0 = _mm256_set1_ps(v.w[0]), w1 = _mm256_set1_ps(v.w[1]), w2 = _mm256_set1_ps(v.w[2]);
+    const __m256 w3 = _mm256_set1_ps(v.w[3]), w4 = _mm256_set1_ps(v.w[4]), w5 = _mm256_set1_ps(v.w[5]);
+    const __m256 w6 = _mm256_set1_ps(v.w[6]), w7 = _mm256_set1_ps(v.w[7]), w8 = _mm256_set1_ps(v.w[8]);
+    const __m256 vt0 = _mm256_set1_ps(v.t[0]), vt1 = _mm256_set1_ps(v.t[1]), vt2 = _mm256_set1_ps(v.t[2]);
+    const __m256 zero = _mm256_setzero_ps(), one = _mm256_set1_ps(1.0f);
+    const __m256 nearClip = _mm256_set1_ps(v.nearClip);
+    const __m256 limX = _mm256_set1_ps(v.limX), limY = _mm256_set1_ps(v.limY);
+    const __m256 negLimX = _mm256_set1_ps(-v.limX), negLimY = _mm256_set1_ps(-v.limY);
+    const __m256 fx = _mm256_set1_ps(v.focalX), fy = _mm256_set1_ps(v.focalY);
+    const __m256 cx = _mm256_set1_ps(v.cx), cy = _mm256_set1_ps(v.cy);
+    const __m256 lowPass = _mm256_set1_ps(LOW_PASS), half = _mm256_set1_ps(0.5f);
+    const __m256 minDisc = _mm256_set1_ps(MIN_DISCRIMINANT), three = _mm256_set1_ps(3.0f);
+
+#define AVX_DOT3(ax, ay, az, bx, by, bz)                                                                          \
+    _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(ax, bx), _mm256_mul_ps(ay, by)), _mm256_mul_ps(az, bz))
+
+    size_t i = begin;
+    for (; i + 8 <= end; i += 8)
+    {
+        const __m256 px = _mm256_loadu_ps(pos[0] + i);
+        const __m256 py = _mm256_loadu_ps(pos[1] + i);
+        const __m256 pz = _mm256_loadu_ps(pos[2] + i);
+        __m256 tx = _mm256_add_ps(AVX_DOT3(w0, w1, w2, px, py, pz), vt0);
+        __m256 ty = _mm256_add_ps(AVX_DOT3(w3, w4, w5, px, py, pz), vt1);
+        const __m256 z = _mm256_sub_ps(zero, _mm256_add_ps(AVX_DOT3(w6, w7, w8, px, py, pz), vt2));
+        _mm256_storeu_ps(out.depth + i, z);
+        const __m256 inFront = _mm256_cmp_ps(z, nearClip, _CMP_GT_OQ);
+
+        const __m256 invZ = _mm256_div_ps(one, z);
+        if (out.mean2D[0])
+        {
+            const __m256 mx = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(fx, tx), invZ), cx);
+            const __m256 my = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(fy, ty), invZ), cy);
+            _mm256_storeu_ps(out.mean2D[0] + i, _mm256_and_ps(mx, inFront));
+            _mm256_storeu_ps(out.mean2D[1] + i, _mm256_and_ps(my, inFront));
+        }
+        tx = _mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(tx, invZ), negLimX), limX), z);
+        ty = _mm256_mul_ps(_mm256_min_ps(_mm256_max_ps(_mm256_mul_ps(ty, invZ), negLimY), limY), z);
+
+        const __m256 invZ2 = _mm256_mul_ps(invZ, invZ);
+        const __m256 j00 = _mm256_mul_ps(fx, invZ);
+        const __m256 j02 = _mm256_mul_ps(_mm256_mul_ps(fx, tx), invZ2);
+        const __m256 j11 = _mm256_mul_ps(fy, invZ);
+        const __m256 j12 = _mm256_mul_ps(_mm256_mul_ps(fy, ty), invZ2);
+        const __m256 t0x = _mm256_add_ps(_mm256_mul_ps(j00, w0), _mm256_mul_ps(j02, w6));
+        const __m256 t0y = _mm256_add_ps(_mm256_mul_ps(j00, w1), _mm256_mul_ps(j02, w7));
+        const __m256 t0z = _mm256_add_ps(_mm256_mul_ps(j00, w2), _mm256_mul_ps(j02, w8));
+        const __m256 t1x = _mm256_add_ps(_mm256_mul_ps(j11, w3), _mm256_mul_ps(j12, w6));
+        const __m256 t1y = _mm256_add_ps(_mm256_mul_ps(j11, w4), _mm256_mul_ps(j12, w7));
+        const __m256 t1z = _mm256_add_ps(_mm256_mul_ps(j11, w5), _mm256_mul_ps(j12, w8));
+
+        const __m256 cxx = _mm256_loadu_ps(cov[0] + i), cxy = _mm256_loadu_ps(cov[1] + i);
+        const __m256 cxz = _mm256_loadu_ps(cov[2] + i), cyy = _mm256_loadu_ps(cov[3] + i);
+        const __m256 cyz = _mm256_loadu_ps(cov[4] + i), czz = _mm256_loadu_ps(cov[5] + i);
+        const __m256 s0x = AVX_DOT3(cxx, cxy, cxz, t0x, t0y, t0z);
+        const __m256 s0y = AVX_DOT3(cxy, cyy, cyz, t0x, t0y, t0z);
+        const __m256 s0z = AVX_DOT3(cxz, cyz, czz, t0x, t0y, t0z);
+        const __m256 s1x = AVX_DOT3(cxx, cxy, cxz, t1x, t1y, t1z);
+        const __m256 s1y = AVX_DOT3(cxy, cyy, cyz, t1x, t1y, t1z);
+        const __m256 s1z = AVX_DOT3(cxz, cyz, czz, t1x, t1y, t1z);
+
+        const __m256 a = _mm256_add_ps(AVX_DOT3(t0x, t0y, t0z, s0x, s0y, s0z), lowPass);
+        const __m256 b = AVX_DOT3(t1x, t1y, t1z, s0x, s0y, s0z);
+        const __m256 c = _mm256_add_ps(AVX_DOT3(t1x, t1y, t1z, s1x, s1y, s1z), lowPass);
+
+        const __m256 det = _mm256_sub_ps(_mm256_mul_ps(a, c), _mm256_mul_ps(b, b));
+        const __m256 valid = _mm256_and_ps(inFront, _mm256_cmp_ps(det, zero, _CMP_GT_OQ));
+        const __m256 invDet = _mm256_div_ps(one, det);
+
+        const __m256 mid = _mm256_mul_ps(half, _mm256_add_ps(a, c));
+        const __m256 disc = _mm256_max_ps(minDisc, _mm256_sub_ps(_mm256_mul_ps(mid, mid), det));
+        const __m256 lambda = _mm256_add_ps(mid, _mm256_sqrt_ps(disc));
+        const __m256 radius = _mm256_ceil_ps(_mm256_mul_ps(three, _mm256_sqrt_ps(lambda)));
+
+        _mm256_storeu_ps(out.cov2D[0] + i, _mm256_and_ps(a, inFront));
+        _mm256_storeu_ps(out.cov2D[1] + i, _mm256_and_ps(b, inFront));
+        _mm256_storeu_ps(out.cov2D[2] + i, _mm256_and_ps(c, inFront));
+        _mm256_storeu_ps(out.conic[0] + i, _mm256_and_ps(_mm256_mul_ps(c, invDet), valid));
+        _mm256_storeu_ps(out.conic[1] + i, _mm256_and_ps(_mm256_sub_ps(zero, _mm256_mul_ps(b, invDet)), valid));
+        _mm256_storeu_ps(out.conic[2] + i, _mm256_and_ps(_mm256_mul_ps(a, invDet), valid));
+        _mm256_storeu_ps(out.radius + i, _mm256_and_ps(radius, valid));
+    }
+#undef AVX_DOT3
+
+    ProjectScalar(v, pos, cov, i, end, out);
+}
+
+#endif // RENDERER_ARCH_X86
+} // namespace
+
+CovarianceProjector::CovarianceProjector() : m_view(), m_level(CpuFeatures::GetSIMDLevel())
+{
+}
+
+void CovarianceProjector::SetView(const float *viewMatrix, float focalX, float focalY, float tanHalfFovX,
+                                  float tanHalfFovY, float nearClip)
+{
+    // 列主序：第 r 行第 c 列位于 viewMatrix[c * 4 + r]
+    for (int r = 0; r < 3; ++r)
+    {
+        for (int c = 0; c < 3; ++c)
+            m_view.w[r * 3 + c] = viewMatrix[c * 4 + r];
+        m_view.t[r] = viewMatrix[12 + r];
+    }
+    m_view.focalX = focalX;
+    m_view.focalY = focalY;
+    m_view.limX = 1.3f * tanHalfFovX;
+    m_view.limY = 1.3f * tanHalfFovY;
+    m_view.nearClip = nearClip;
+}
+
+void CovarianceProjector::SetSIMDLevel(CpuFeatures::SIMDLevel level)
+{
+    m_level = std::min(level, CpuFeatures::GetSIMDLevel());
+}
+
+void CovarianceProjector::Project(const float *const *position, const float *const *covariance, size_t begin,
+                                  size_t end, const SplatProjectionOutput &output) const
+{
+#if RENDERER_ARCH_X86
+    if (m_level == CpuFeatures::SIMDLevel::AVX2)
+    {
+        ProjectBatchAVX2(m_view, position, covariance, begin, end, output);
+        return;
+    }
+    if (m_level == CpuFeatures::SIMDLevel::SSE41)
+    {
+        ProjectBatchSSE4(m_view, position, covariance, begin, end, output);
+        return;
+    }
+#endif
+    ProjectScalar(m_view, position, covariance, begin, end, output);
+}
+
+RENDERER_NAMESPACE_END
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Core/CpuFeatures.h"
+#include "Core/RenderCore.h"
+#include <cstddef>
+
+RENDERER_NAMESPACE_BEGIN
+
+/// 投影结果（SoA，每个平面长度至少为处理区间的末尾下标）
+struct SplatProjectionOutput
+{
+    float *cov2D[3] = {nullptr, nullptr, nullptr}; // 屏幕空间 2D 协方差 a, b, c（[a b; b c]，已加 0.3 低通）
+    float *conic[3] = {nullptr, nullptr, nullptr}; // 2D 协方差的逆：(c, -b, a) / det
+    float *radius = nullptr;                       // 3σ 屏幕半径（像素，向上取整），0 表示不可见
+    float *depth = nullptr;                        // 视空间深度（相机前方为正）
+    float *mean2D[2] = {nullptr, nullptr};         // 可选：屏幕空间中心（像素，加上主点偏移），为空时不输出
+};
+
+/// 批量 EWA 协方差投影：Σ' = J·W·Σ·Wᵀ·Jᵀ
+///
+/// 与 CovarianceUtils::project3DCovariance 数学等价，但
+///   - 视图相关量（W、平移、焦距、视锥裁剪范围）在 SetView() 中一次性准备，不在逐高斯循环中重建
+///   - 输入为 SoA 平面（位置 3 个、协方差 6 个独立元素），每次迭代处理 8 个高斯
+///   - 运行时选择 AVX2 / SSE4.1 / 标量内核
+///
+/// 约定：viewMatrix 为列主序 4x4（glm / OpenGL），相机看向 -Z；屏幕坐标 y 轴向上
+class RENDERER_API CovarianceProjector
+{
+public:
+    CovarianceProjector();
+
+    /// @param viewMatrix  列主序视图矩阵
+    /// @param focalX/Y    像素焦距：width / (2 tan(fovX / 2))，height / (2 tan(fovY / 2))
+    /// @param tanHalfFovX/Y 用于将视锥外高斯的 Jacobian 限制在 1.3 倍视锥内，避免边缘处投影发散
+    /// @param nearClip    深度小于该值的高斯视为不可见
+    void SetView(const float *viewMatrix, float focalX, float focalY, float tanHalfFovX, float tanHalfFovY,
+                 float nearClip = 0.01f);
+
+    /// 屏幕中心输出的主点偏移（像素），通常为 (width / 2, height / 2)；默认 0，即相对图像中心
+    void SetPrincipalPoint(float cx, float cy)
+    {
+        m_view.cx = cx;
+        m_view.cy = cy;
+    }
+
+    /// 投影 [begin, end) 区间的高斯
+    /// @param position   x, y, z 三个平面
+    /// @param covariance xx, xy, xz, yy, yz, zz 六个平面（GaussianCloud::Attribute::Covariance）
+    void Project(const float *const *position, const float *const *covariance, size_t begin, size_t end,
+                 const SplatProjectionOutput &output) const;
+
+    /// 强制指定内核（用于对比测试），不支持的等级会自动降级
+    void SetSIMDLevel(CpuFeatures::SIMDLevel level);
+    CpuFeatures::SIMDLevel GetSIMDLevel() const
+    {
+        return m_level;
+    }
+
+    /// 视图相关的常量，逐高斯循环中只读
+    struct ViewConstants
+    {
+        float w[9];  // 视图矩阵旋转部分（行主序）
+        float t[3];  // 视图矩阵平移
+        float focalX;
+        float focalY;
+        float limX; // 1.3 * tan(fovX / 2)
+        float limY;
+        float nearClip;
+        float cx; // 主点
+        float cy;
+    };
+
+private:
+    ViewConstants m_view;
+    CpuFeatures::SIMDLevel m_level;
+};
+
+RENDERER_NAMESPACE_END
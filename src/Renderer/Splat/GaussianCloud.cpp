@@ -0,0 +1,238 @@
+#include "Splat/GaussianCloud.h"
+#include "Core/ThreadPool.h"
+#include "MathUtils/Covariance.h"
+#include "Splat/RadixSort.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <new>
+#include <stdexcept>
+
+RENDERER_NAMESPACE_BEGIN
+
+// 协方差批处理每个任务的高斯数
+static const size_t COVARIANCE_GRAIN_SIZE = 16384;
+
+// 重排时每个任务处理的高斯数
+static const size_t REORDER_GRAIN_SIZE = 65536;
+// Morton 码每轴位数（3 × 10 位放入 32 位键）
+static const int MORTON_BITS_PER_AXIS = 10;
+
+static size_t AlignUp(size_t value, size_t alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+// 把 10 位整数的各位间隔两位展开：b9..b0 -> b9 0 0 b8 0 0 ... b0
+static uint32_t ExpandBits10(uint32_t v)
+{
+    v &= 0x3FFu;
+    v = (v | (v << 16)) & 0x030000FFu;
+    v = (v | (v << 8)) & 0x0300F00Fu;
+    v = (v | (v << 4)) & 0x030C30C3u;
+    v = (v | (v << 2)) & 0x09249249u;
+    return v;
+}
+
+GaussianCloud::GaussianCloud()
+{
+}
+
+GaussianCloud::~GaussianCloud()
+{
+}
+
+int GaussianCloud::GetSHRestCoeffCount(int shDegree)
+{
+    shDegree = std::max(0, std::min(MAX_SH_DEGREE, shDegree));
+    return (shDegree + 1) * (shDegree + 1) - 1;
+}
+
+int GaussianCloud::GetComponentCount(Attribute attr, int shDegree)
+{
+    switch (attr)
+    {
+    case Attribute::Position:
+    case Attribute::Scale:
+    case Attribute::SHDC:
+        return 3;
+    case Attribute::Rotation:
+        return 4;
+    case Attribute::Covariance:
+        return 6;
+    case Attribute::Opacity:
+        return 1;
+    case Attribute::SHRest:
+        return GetSHRestCoeffCount(shDegree) * 3;
+    default:
+        return 0;
+    }
+}
+
+size_t GaussianCloud::GetLayout(size_t count, int shDegree, size_t *offsets)
+{
+    size_t offset = 0;
+    for (int i = 0; i < static_cast<int>(Attribute::Count); ++i)
+    {
+        offsets[i] = offset;
+        size_t bytes = count * GetComponentCount(static_cast<Attribute>(i), shDegree) * sizeof(float);
+        offset += AlignUp(bytes, SECTION_ALIGNMENT);
+    }
+    return offset;
+}
+
+void GaussianCloud::Allocate(size_t count, int shDegree)
+{
+    if (shDegree < 0 || shDegree > MAX_SH_DEGREE)
+        throw std::invalid_argument("GaussianCloud::Allocate: SH degree must be in [0, 3]");
+
+    m_count = count;
+    m_shDegree = shDegree;
+    m_storageSize = GetLayout(count, shDegree, m_offsets);
+
+    // 64 字节对齐分配（C++17 对齐 new），删除器需使用相同对齐
+    const size_t allocSize = std::max<size_t>(m_storageSize, SECTION_ALIGNMENT);
+    unsigned char *memory =
+        static_cast<unsigned char *>(::operator new(allocSize, std::align_val_t(SECTION_ALIGNMENT)));
+    m_storage.reset(memory, [](unsigned char *p) { ::operator delete(p, std::align_val_t(SECTION_ALIGNMENT)); });
+}
+
+bool GaussianCloud::AdoptStorage(const std::shared_ptr<unsigned char> &storage, size_t storageSize, size_t count,
+                                 int shDegree)
+{
+    if (!storage || shDegree < 0 || shDegree > MAX_SH_DEGREE)
+        return false;
+
+    size_t offsets[static_cast<int>(Attribute::Count)];
+    size_t requiredSize = GetLayout(count, shDegree, offsets);
+    if (storageSize < requiredSize)
+        return false;
+    if (reinterpret_cast<uintptr_t>(storage.get()) % SECTION_ALIGNMENT != 0)
+        return false;
+
+    m_count = count;
+    m_shDegree = shDegree;
+    m_storageSize = requiredSize;
+    std::copy(offsets, offsets + static_cast<int>(Attribute::Count), m_offsets);
+    m_storage = storage;
+    return true;
+}
+
+float *GaussianCloud::GetAttribute(Attribute attr)
+{
+    return reinterpret_cast<float *>(m_storage.get() + m_offsets[static_cast<int>(attr)]);
+}
+
+const float *GaussianCloud::GetAttribute(Attribute attr) const
+{
+    return reinterpret_cast<const float *>(m_storage.get() + m_offsets[static_cast<int>(attr)]);
+}
+
+float *GaussianCloud::GetComponent(Attribute attr, int component)
+{
+    return GetAttribute(attr) + static_cast<size_t>(component) * m_count;
+}
+
+const float *GaussianCloud::GetComponent(Attribute attr, int component) const
+{
+    return GetAttribute(attr) + static_cast<size_t>(component) * m_count;
+}
+
+size_t GaussianCloud::GetAttributeBytes(Attribute attr) const
+{
+    return m_count * GetComponentCount(attr, m_shDegree) * sizeof(float);
+}
+
+void GaussianCloud::ComputeCovariances()
+{
+    const FLOAT *scale[3], *rotation[4];
+    FLOAT *cov[6];
+    for (int c = 0; c < 3; ++c)
+        scale[c] = GetComponent(Attribute::Scale, c);
+    for (int c = 0; c < 4; ++c)
+        rotation[c] = GetComponent(Attribute::Rotation, c);
+    for (int c = 0; c < 6; ++c)
+        cov[c] = GetComponent(Attribute::Covariance, c);
+
+    ThreadPool::Global().ParallelFor(0, m_count, COVARIANCE_GRAIN_SIZE, [&](size_t begin, size_t end, unsigned int) {
+        CovarianceUtils::compute3DCovarianceBatch(scale, rotation, cov, begin, end);
+    });
+}
+
+void GaussianCloud::Reorder(const uint32_t *order)
+{
+    if (m_count == 0)
+        return;
+
+    std::vector<float> scratch(m_count);
+    ThreadPool &pool = ThreadPool::Global();
+    for (int i = 0; i < static_cast<int>(Attribute::Count); ++i)
+    {
+        const Attribute attr = static_cast<Attribute>(i);
+        for (int c = 0; c < GetComponentCount(attr, m_shDegree); ++c)
+        {
+            float *plane = GetComponent(attr, c);
+            pool.ParallelFor(0, m_count, REORDER_GRAIN_SIZE, [&](size_t begin, size_t end, unsigned int) {
+                for (size_t k = begin; k < end; ++k)
+                    scratch[k] = plane[order[k]];
+            });
+            std::memcpy(plane, scratch.data(), m_count * sizeof(float));
+        }
+    }
+    m_mortonOrdered = false;
+}
+
+void GaussianCloud::ComputeMortonCodes(uint32_t *codes) const
+{
+    // 包围盒归一化到 [0, 1023] 的格点
+    const float cells = static_cast<float>((1u << MORTON_BITS_PER_AXIS) - 1);
+    float origin[3];
+    float invExtent[3];
+    for (int c = 0; c < 3; ++c)
+    {
+        const float extent = m_boundsMax[c] - m_boundsMin[c];
+        origin[c] = m_boundsMin[c];
+        invExtent[c] = extent > 0.0f ? cells / extent : 0.0f;
+    }
+    const float *position[3] = {GetComponent(Attribute::Position, 0), GetComponent(Attribute::Position, 1),
+                                GetComponent(Attribute::Position, 2)};
+
+    ThreadPool::Global().ParallelFor(0, m_count, REORDER_GRAIN_SIZE, [&](size_t begin, size_t end, unsigned int) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            uint32_t cell[3];
+            for (int c = 0; c < 3; ++c)
+            {
+                const float t = (position[c][i] - origin[c]) * invExtent[c];
+                cell[c] = static_cast<uint32_t>(std::min(std::max(t, 0.0f), cells));
+            }
+            codes[i] = ExpandBits10(cell[0]) | (ExpandBits10(cell[1]) << 1) | (ExpandBits10(cell[2]) << 2);
+        }
+    });
+}
+
+void GaussianCloud::ReorderMorton()
+{
+    std::vector<uint32_t> codes(m_count);
+    std::vector<uint32_t> order(m_count);
+    ComputeMortonCodes(codes.data());
+    for (size_t i = 0; i < m_count; ++i)
+        order[i] = static_cast<uint32_t>(i);
+
+    RadixSorter sorter(ThreadPool::Global());
+    sorter.Sort(codes.data(), order.data(), m_count);
+    Reorder(order.data());
+    m_mortonOrdered = true;
+}
+
+void GaussianCloud::SetBounds(const float *boundsMin, const float *boundsMax)
+{
+    for (int i = 0; i < 3; ++i)
+    {
+        m_boundsMin[i] = boundsMin[i];
+        m_boundsMax[i] = boundsMax[i];
+    }
+}
+
+RENDERER_NAMESPACE_END
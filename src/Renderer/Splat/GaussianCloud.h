@@ -0,0 +1,131 @@
+#pragma once
+
+#include "Core/RenderCore.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+RENDERER_NAMESPACE_BEGIN
+
+/// 高斯点云：3DGS 训练结果的 SoA（Structure of Arrays）存储
+///
+/// 每个属性按分量平面化存放：属性 attr 的第 c 个分量、第 i 个高斯位于
+///   GetAttribute(attr)[c * count + i]
+/// 所有属性段共用一块内存，每段起始地址 64 字节对齐，便于 SIMD 批处理与整段上传 GPU。
+/// 存入的都是激活后的值：scale 已取 exp，opacity 已过 sigmoid，rotation 已归一化。
+class RENDERER_API GaussianCloud
+{
+public:
+    enum class Attribute
+    {
+        Position = 0, // x, y, z
+        Scale,        // sx, sy, sz（exp 激活后）
+        Rotation,     // qx, qy, qz, qw（归一化，与 CovarianceUtils 约定一致）
+        Covariance,   // 3D 协方差的 6 个独立元素：xx, xy, xz, yy, yz, zz（加载时预计算）
+        Opacity,      // alpha（sigmoid 激活后）
+        SHDC,         // f_dc_0..2（0 阶球谐系数，RGB）
+        SHRest,       // f_rest_*，按通道主序：分量 = channel * restCoeffCount + k
+        Count
+    };
+
+    static constexpr size_t SECTION_ALIGNMENT = 64;
+    static constexpr int MAX_SH_DEGREE = 3;
+
+    GaussianCloud();
+    ~GaussianCloud();
+
+    GaussianCloud(const GaussianCloud &) = delete;
+    GaussianCloud &operator=(const GaussianCloud &) = delete;
+
+    /// 为 count 个高斯分配存储（内容未初始化）
+    void Allocate(size_t count, int shDegree);
+    /// 接管外部存储（如内存映射的 .gsc 缓存），布局必须与 GetLayout() 一致
+    /// storage 的生命周期由 shared_ptr 管理（可借助别名构造持有映射对象）
+    bool AdoptStorage(const std::shared_ptr<unsigned char> &storage, size_t storageSize, size_t count,
+                      int shDegree);
+
+    /// 计算各属性段相对存储起点的偏移（offsets 长度为 Attribute::Count），返回存储总字节数
+    static size_t GetLayout(size_t count, int shDegree, size_t *offsets);
+    /// 属性段相对存储起点的字节偏移
+    size_t GetAttributeOffset(Attribute attr) const
+    {
+        return m_offsets[static_cast<int>(attr)];
+    }
+
+    size_t GetCount() const
+    {
+        return m_count;
+    }
+    int GetSHDegree() const
+    {
+        return m_shDegree;
+    }
+    /// 每个通道的高阶球谐系数个数：(degree + 1)^2 - 1
+    static int GetSHRestCoeffCount(int shDegree);
+    /// 属性的分量数（SHRest 取决于球谐阶数）
+    static int GetComponentCount(Attribute attr, int shDegree);
+
+    /// 属性段首地址（分量 c 的平面位于 + c * GetCount()）
+    float *GetAttribute(Attribute attr);
+    const float *GetAttribute(Attribute attr) const;
+    /// 属性中第 component 个分量的平面首地址
+    float *GetComponent(Attribute attr, int component);
+    const float *GetComponent(Attribute attr, int component) const;
+    /// 属性段的有效字节数（不含对齐填充）
+    size_t GetAttributeBytes(Attribute attr) const;
+
+    /// 由 Scale + Rotation 批量计算 Covariance 属性（多线程，加载时调用一次，逐帧只需投影）
+    void ComputeCovariances();
+
+    // ---- 空间排序（导入时调用） ----
+    /// 按 order 重排所有属性：新的第 i 个高斯为原来的第 order[i] 个（逐分量平面并行 gather）
+    void Reorder(const uint32_t *order);
+    /// 按位置的 3D Morton 码（包围盒归一化，每轴 10 位）稳定重排，需已设置包围盒
+    /// 重排后下标相邻的高斯在空间上也相邻：投影、剔除的访存连续，GPU 读取更易合并，
+    /// 连续的下标区间即可作为空间分块（见 SplatChunkSet）
+    void ReorderMorton();
+    /// 按包围盒归一化计算每个高斯位置的 30 位 Morton 码（多线程），codes 长度为 GetCount()
+    void ComputeMortonCodes(uint32_t *codes) const;
+    bool IsMortonOrdered() const
+    {
+        return m_mortonOrdered;
+    }
+    /// 标记存储已按 Morton 序排列（如从缓存加载时）
+    void SetMortonOrdered(bool ordered)
+    {
+        m_mortonOrdered = ordered;
+    }
+
+    // ---- 包围盒（加载时计算） ----
+    void SetBounds(const float *boundsMin, const float *boundsMax);
+    const float *GetBoundsMin() const
+    {
+        return m_boundsMin;
+    }
+    const float *GetBoundsMax() const
+    {
+        return m_boundsMax;
+    }
+
+    /// 底层连续存储（所有属性段）
+    const unsigned char *GetStorage() const
+    {
+        return m_storage.get();
+    }
+    size_t GetStorageSize() const
+    {
+        return m_storageSize;
+    }
+
+private:
+    std::shared_ptr<unsigned char> m_storage;
+    size_t m_storageSize = 0;
+    size_t m_offsets[static_cast<int>(Attribute::Count)] = {};
+    size_t m_count = 0;
+    int m_shDegree = 0;
+    float m_boundsMin[3] = {0.0f, 0.0f, 0.0f};
+    float m_boundsMax[3] = {0.0f, 0.0f, 0.0f};
+    bool m_mortonOrdered = false;
+};
+
+RENDERER_NAMESPACE_END
@@ -0,0 +1,117 @@
+#include "Splat/GpuSplatPreprocessor.h"
+#include "ShaderManager.h"
+#include <glad/glad.h>
+#include <algorithm>
+#include <stdexcept>
+
+RENDERER_NAMESPACE_BEGIN
+
+namespace
+{
+// SSBO 绑定点，与 splat_preprocess.cs.glsl 一致
+const GLuint CLOUD_BINDING = 0;
+const GLuint RECORD_BINDING = 2;
+const GLuint VISIBLE_BINDING = 3;
+const GLuint COMMAND_BINDING = 4;
+const GLuint SORT_KEY_BINDING = 5;
+const GLuint SORT_INDEX_BINDING = 6;
+
+// 与 GL 的 DrawArraysIndirectCommand 布局相同
+struct DrawArraysIndirectCommand
+{
+    GLuint count;
+    GLuint instanceCount;
+    GLuint first;
+    GLuint baseInstance;
+};
+
+const size_t MAX_GROUPS_PER_DIMENSION = 65535;
+
+// 每个高斯一个三角形带四边形面片
+const DrawArraysIndirectCommand RESET_COMMAND = {4, 0, 0, 0};
+
+GLuint CreateStorageBuffer(size_t size, const void *data)
+{
+    GLuint buffer = 0;
+    glGenBuffers(1, &buffer);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, buffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, static_cast<GLsizeiptr>(size), data, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+    return buffer;
+}
+} // namespace
+
+GpuSplatPreprocessor::GpuSplatPreprocessor(ShaderManager &shaderManager)
+{
+    m_shader = shaderManager.LoadComputeShader("splat_preprocess", "res/shaders/splat_preprocess.cs.glsl");
+    if (!m_shader)
+    {
+        throw std::runtime_error("GpuSplatPreprocessor initialization failed: compute shader load failed");
+    }
+}
+
+GpuSplatPreprocessor::~GpuSplatPreprocessor()
+{
+    ReleaseBuffers();
+}
+
+void GpuSplatPreprocessor::ReleaseBuffers()
+{
+    GLuint buffers[] = {m_recordBuffer, m_visibleBuffer, m_commandBuffer};
+    for (GLuint buffer : buffers)
+    {
+        if (buffer != 0)
+            glDeleteBuffers(1, &buffer);
+    }
+    m_recordBuffer = 0;
+    m_visibleBuffer = 0;
+    m_commandBuffer = 0;
+    m_count = 0;
+}
+
+void GpuSplatPreprocessor::Resize(size_t count)
+{
+    ReleaseBuffers();
+    if (count == 0)
+        return;
+
+    m_count = count;
+    m_recordBuffer = CreateStorageBuffer(count * RECORD_SIZE, nullptr);
+    m_visibleBuffer = CreateStorageBuffer(count * sizeof(uint32_t), nullptr);
+    m_commandBuffer = CreateStorageBuffer(sizeof(DrawArraysIndirectCommand), &RESET_COMMAND);
+}
+
+void GpuSplatPreprocessor::Run(unsigned int cloudBuffer, unsigned int sortKeyBuffer, unsigned int sortIndexBuffer)
+{
+    if (m_count == 0)
+        return;
+
+    // 上一帧的绘制仍可能在读取命令缓冲，glBufferSubData 由驱动保证顺序
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_commandBuffer);
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, sizeof(DrawArraysIndirectCommand), &RESET_COMMAND);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+    const bool writeSortKeys = sortKeyBuffer != 0 && sortIndexBuffer != 0;
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, CLOUD_BINDING, cloudBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, RECORD_BINDING, m_recordBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, VISIBLE_BINDING, m_visibleBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, COMMAND_BINDING, m_commandBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, SORT_KEY_BINDING, writeSortKeys ? sortKeyBuffer : 0);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, SORT_INDEX_BINDING, writeSortKeys ? sortIndexBuffer : 0);
+
+    m_shader->use();
+    m_shader->setInt("u_writeSortKeys", writeSortKeys ? 1 : 0);
+    // 每维工作组数只保证 65535，更大的点云改为二维网格
+    const size_t groups = (m_count + WORKGROUP_SIZE - 1) / WORKGROUP_SIZE;
+    const size_t groupsX = std::min<size_t>(groups, MAX_GROUPS_PER_DIMENSION);
+    const size_t groupsY = (groups + groupsX - 1) / groupsX;
+    m_shader->dispatch(static_cast<unsigned int>(groupsX), static_cast<unsigned int>(groupsY));
+    // 记录与可见列表随后作为 SSBO 读取，命令缓冲作为间接绘制参数读取
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_COMMAND_BARRIER_BIT);
+
+    for (GLuint binding = CLOUD_BINDING; binding <= SORT_INDEX_BINDING; ++binding)
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, 0);
+    glUseProgram(0);
+}
+
+RENDERER_NAMESPACE_END
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Core/RenderCore.h"
+#include "Shader.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+RENDERER_NAMESPACE_BEGIN
+
+class ShaderManager;
+
+/// GPU 逐高斯预处理：计算着色器完成视图变换、剔除、EWA 投影、面片半轴与球谐颜色
+///
+/// 每帧对全部高斯派发一次 splat_preprocess.cs.glsl，按高斯下标写出绘制所需的记录，
+/// 可见高斯压缩进可见列表，可见数直接累加到 DrawArraysIndirectCommand 的 instanceCount，
+/// 绘制以 glDrawArraysIndirect 读取该命令。CPU 每帧只设置 uniform 与派发，开销与高斯数无关。
+/// 可选地同时为 GpuSplatSorter 写出深度键（被剔除的高斯排在最后），排序结果的前 instanceCount 项即可见高斯。
+/// 需要在有效的 GL 4.3 上下文中构造和调用。
+class RENDERER_API GpuSplatPreprocessor
+{
+public:
+    // 与 splat_preprocess.cs.glsl / splat_common.glsl 保持一致
+    static constexpr unsigned int WORKGROUP_SIZE = 256;
+    static constexpr size_t RECORD_SIZE = 48; // PreprocessedSplat 的 std430 大小
+
+    /// 加载预处理计算着色器，失败时抛出 std::runtime_error
+    explicit GpuSplatPreprocessor(ShaderManager &shaderManager);
+    ~GpuSplatPreprocessor();
+
+    GpuSplatPreprocessor(const GpuSplatPreprocessor &) = delete;
+    GpuSplatPreprocessor &operator=(const GpuSplatPreprocessor &) = delete;
+
+    /// 按高斯数分配记录、可见列表与间接绘制命令缓冲，0 表示释放
+    void Resize(size_t count);
+
+    /// 预处理程序：调用方 use() 后设置视图、点云布局与剔除阈值等 uniform，再调用 Run()
+    const Shader &GetShader() const
+    {
+        return *m_shader;
+    }
+
+    /// 清零实例计数并以当前程序对全部高斯派发预处理；cloudBuffer 为整块点云 SSBO
+    /// sortKeyBuffer / sortIndexBuffer 非 0 时同时写出排序键与初始下标（长度不小于高斯数）
+    void Run(unsigned int cloudBuffer, unsigned int sortKeyBuffer = 0, unsigned int sortIndexBuffer = 0);
+
+    /// 预处理记录 SSBO（按高斯下标）
+    unsigned int GetRecordBuffer() const
+    {
+        return m_recordBuffer;
+    }
+    /// 可见高斯下标 SSBO（前 instanceCount 项有效，顺序不定）
+    unsigned int GetVisibleBuffer() const
+    {
+        return m_visibleBuffer;
+    }
+    /// DrawArraysIndirectCommand {4, instanceCount, 0, 0}，同时可作为 SSBO 读取
+    unsigned int GetCommandBuffer() const
+    {
+        return m_commandBuffer;
+    }
+    size_t GetCount() const
+    {
+        return m_count;
+    }
+
+private:
+    void ReleaseBuffers();
+
+    std::shared_ptr<Shader> m_shader;
+
+    size_t m_count = 0;
+    unsigned int m_recordBuffer = 0;
+    unsigned int m_visibleBuffer = 0;
+    unsigned int m_commandBuffer = 0;
+};
+
+RENDERER_NAMESPACE_END
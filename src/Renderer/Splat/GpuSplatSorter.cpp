@@ -0,0 +1,171 @@
+#include "Splat/GpuSplatSorter.h"
+#include "ShaderManager.h"
+#include <glad/glad.h>
+#include <stdexcept>
+
+RENDERER_NAMESPACE_BEGIN
+
+namespace
+{
+// SSBO 绑定点，与 splat_sort_common.glsl 一致
+const GLuint POSITION_BINDING = 0;
+const GLuint KEY_IN_BINDING = 1;
+const GLuint VALUE_IN_BINDING = 2;
+const GLuint KEY_OUT_BINDING = 3;
+const GLuint VALUE_OUT_BINDING = 4;
+const GLuint HISTOGRAM_BINDING = 5;
+const GLuint BUCKET_OFFSET_BINDING = 6;
+
+GLuint CreateStorageBuffer(size_t size, const void *data)
+{
+    GLuint buffer = 0;
+    glGenBuffers(1, &buffer);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, buffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, static_cast<GLsizeiptr>(size), data, GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+    return buffer;
+}
+} // namespace
+
+GpuSplatSorter::GpuSplatSorter(ShaderManager &shaderManager)
+{
+    m_keyShader = shaderManager.LoadComputeShader("splat_sort_keys", "res/shaders/splat_sort_keys.cs.glsl");
+    m_histogramShader =
+        shaderManager.LoadComputeShader("splat_sort_histogram", "res/shaders/splat_sort_histogram.cs.glsl");
+    m_scanShader = shaderManager.LoadComputeShader("splat_sort_scan", "res/shaders/splat_sort_scan.cs.glsl");
+    m_scatterShader = shaderManager.LoadComputeShader("splat_sort_scatter", "res/shaders/splat_sort_scatter.cs.glsl");
+    if (!m_keyShader || !m_histogramShader || !m_scanShader || !m_scatterShader)
+    {
+        throw std::runtime_error("GpuSplatSorter initialization failed: compute shader load failed");
+    }
+}
+
+GpuSplatSorter::~GpuSplatSorter()
+{
+    ReleaseBuffers();
+}
+
+void GpuSplatSorter::ReleaseBuffers()
+{
+    GLuint buffers[] = {m_positionBuffer,  m_keyBuffers[0],   m_keyBuffers[1],       m_valueBuffers[0],
+                        m_valueBuffers[1], m_histogramBuffer, m_bucketOffsetBuffer};
+    for (GLuint buffer : buffers)
+    {
+        if (buffer != 0)
+            glDeleteBuffers(1, &buffer);
+    }
+    m_positionBuffer = 0;
+    m_keyBuffers[0] = m_keyBuffers[1] = 0;
+    m_valueBuffers[0] = m_valueBuffers[1] = 0;
+    m_histogramBuffer = 0;
+    m_bucketOffsetBuffer = 0;
+    m_count = 0;
+    m_workgroupCount = 0;
+}
+
+void GpuSplatSorter::SetPositions(const float *const *position, size_t count)
+{
+    Resize(count);
+    if (count == 0)
+        return;
+
+    // 位置按 x|y|z 三个平面连续存放
+    const size_t planeBytes = count * sizeof(float);
+    m_positionBuffer = CreateStorageBuffer(planeBytes * 3, nullptr);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_positionBuffer);
+    for (int c = 0; c < 3; ++c)
+        glBufferSubData(GL_SHADER_STORAGE_BUFFER, static_cast<GLintptr>(planeBytes * c),
+                        static_cast<GLsizeiptr>(planeBytes), position[c]);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+}
+
+void GpuSplatSorter::Resize(size_t count)
+{
+    ReleaseBuffers();
+    if (count == 0)
+        return;
+
+    m_count = count;
+    m_workgroupCount = static_cast<unsigned int>((count + TILE_SIZE - 1) / TILE_SIZE);
+    for (int i = 0; i < 2; ++i)
+    {
+        m_keyBuffers[i] = CreateStorageBuffer(count * sizeof(uint32_t), nullptr);
+        m_valueBuffers[i] = CreateStorageBuffer(count * sizeof(uint32_t), nullptr);
+    }
+    m_histogramBuffer = CreateStorageBuffer(static_cast<size_t>(RADIX) * m_workgroupCount * sizeof(uint32_t), nullptr);
+    m_bucketOffsetBuffer = CreateStorageBuffer(RADIX * sizeof(uint32_t), nullptr);
+}
+
+void GpuSplatSorter::Sort(const float *viewMatrix)
+{
+    if (m_count == 0 || m_positionBuffer == 0)
+        return;
+
+    const GLuint count = static_cast<GLuint>(m_count);
+
+    // 1. 深度键 + 初始下标，写入 [0]
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, POSITION_BINDING, m_positionBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, KEY_OUT_BINDING, m_keyBuffers[0]);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, VALUE_OUT_BINDING, m_valueBuffers[0]);
+    m_keyShader->use();
+    m_keyShader->setUint("u_count", count);
+    m_keyShader->setVec4("u_viewRow", viewMatrix[2], viewMatrix[6], viewMatrix[10], viewMatrix[14]);
+    m_keyShader->dispatch(m_workgroupCount);
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+
+    SortKeys();
+}
+
+void GpuSplatSorter::SortKeys()
+{
+    if (m_count == 0)
+        return;
+
+    const GLuint count = static_cast<GLuint>(m_count);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, HISTOGRAM_BINDING, m_histogramBuffer);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, BUCKET_OFFSET_BINDING, m_bucketOffsetBuffer);
+
+    // 2. 4 趟 8 位基数排序，[0] -> [1] -> [0] ...
+    int src = 0;
+    for (unsigned int shift = 0; shift < 32; shift += 8)
+    {
+        const int dst = 1 - src;
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, KEY_IN_BINDING, m_keyBuffers[src]);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, VALUE_IN_BINDING, m_valueBuffers[src]);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, KEY_OUT_BINDING, m_keyBuffers[dst]);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, VALUE_OUT_BINDING, m_valueBuffers[dst]);
+
+        m_histogramShader->use();
+        m_histogramShader->setUint("u_count", count);
+        m_histogramShader->setUint("u_workgroupCount", m_workgroupCount);
+        m_histogramShader->setUint("u_shift", shift);
+        m_histogramShader->dispatch(m_workgroupCount);
+        glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+
+        m_scanShader->use();
+        m_scanShader->setUint("u_workgroupCount", m_workgroupCount);
+        m_scanShader->setUint("u_stage", 0);
+        m_scanShader->dispatch(RADIX);
+        glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+        m_scanShader->setUint("u_stage", 1);
+        m_scanShader->dispatch(1);
+        glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+
+        m_scatterShader->use();
+        m_scatterShader->setUint("u_count", count);
+        m_scatterShader->setUint("u_workgroupCount", m_workgroupCount);
+        m_scatterShader->setUint("u_shift", shift);
+        m_scatterShader->dispatch(m_workgroupCount);
+        glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT);
+
+        src = dst;
+    }
+
+    // 索引缓冲随后可能作为 SSBO、顶点属性或索引数组被读取
+    glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT | GL_ELEMENT_ARRAY_BARRIER_BIT);
+    for (GLuint binding = POSITION_BINDING; binding <= BUCKET_OFFSET_BINDING; ++binding)
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, binding, 0);
+    glUseProgram(0);
+}
+
+RENDERER_NAMESPACE_END
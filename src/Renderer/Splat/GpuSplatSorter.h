@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Core/RenderCore.h"
+#include "Shader.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+RENDERER_NAMESPACE_BEGIN
+
+class ShaderManager;
+
+/// GPU 高斯深度排序：计算着色器生成深度键，再对 SSBO 做 4 趟 8 位 LSD 基数排序
+///
+/// 每趟：各工作组统计分块直方图 -> 两级前缀和（逐桶跨工作组、跨桶）-> 稳定散射。
+/// 排序结果（从后往前的高斯下标）留在 GetIndexBuffer() 返回的 SSBO 中供绘制直接使用，全程无 CPU 回读。
+/// 需要在有效的 GL 4.3 上下文中构造和调用。
+class RENDERER_API GpuSplatSorter
+{
+public:
+    // 与 splat_sort_common.glsl 保持一致
+    static constexpr unsigned int WORKGROUP_SIZE = 256;
+    static constexpr unsigned int ITEMS_PER_THREAD = 16;
+    static constexpr unsigned int TILE_SIZE = WORKGROUP_SIZE * ITEMS_PER_THREAD;
+    static constexpr unsigned int RADIX = 256;
+
+    /// 加载排序所需的计算着色器，失败时抛出 std::runtime_error
+    explicit GpuSplatSorter(ShaderManager &shaderManager);
+    ~GpuSplatSorter();
+
+    GpuSplatSorter(const GpuSplatSorter &) = delete;
+    GpuSplatSorter &operator=(const GpuSplatSorter &) = delete;
+
+    /// 上传位置数据（x, y, z 三个平面）并按数量分配排序缓冲
+    void SetPositions(const float *const *position, size_t count);
+    /// 只按数量分配排序缓冲，不上传位置：键由调用方写入后调用 SortKeys()
+    void Resize(size_t count);
+
+    /// 按列主序视图矩阵排序，结果写入索引缓冲；之后的绘制/计算命令可直接读取（需先 SetPositions）
+    void Sort(const float *viewMatrix);
+    /// 对调用方已写入 GetKeyBuffer() / GetIndexBuffer() 的键与下标直接做基数排序（升序）
+    void SortKeys();
+
+    /// 排序键 SSBO（uint，长度为 GetCount()），SortKeys() 的输入
+    unsigned int GetKeyBuffer() const
+    {
+        return m_keyBuffers[0];
+    }
+
+    /// 排序后的索引 SSBO（uint，从后往前）
+    unsigned int GetIndexBuffer() const
+    {
+        return m_valueBuffers[0];
+    }
+    size_t GetCount() const
+    {
+        return m_count;
+    }
+
+private:
+    void ReleaseBuffers();
+
+    std::shared_ptr<Shader> m_keyShader;
+    std::shared_ptr<Shader> m_histogramShader;
+    std::shared_ptr<Shader> m_scanShader;
+    std::shared_ptr<Shader> m_scatterShader;
+
+    size_t m_count = 0;
+    unsigned int m_workgroupCount = 0;
+    unsigned int m_positionBuffer = 0;
+    // 乒乓缓冲：偶数趟数结束后结果位于 [0]
+    unsigned int m_keyBuffers[2] = {0, 0};
+    unsigned int m_valueBuffers[2] = {0, 0};
+    unsigned int m_histogramBuffer = 0;    // [bucket][workgroup]
+    unsigned int m_bucketOffsetBuffer = 0; // 每个桶的全局起点
+};
+
+RENDERER_NAMESPACE_END
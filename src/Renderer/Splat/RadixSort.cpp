@@ -0,0 +1,125 @@
+#include "Splat/RadixSort.h"
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+RENDERER_NAMESPACE_BEGIN
+
+namespace
+{
+// 每块至少包含的元素数，块过小时线程调度开销会超过收益
+const size_t MIN_BLOCK_SIZE = 16384;
+} // namespace
+
+RadixSorter::RadixSorter(ThreadPool &pool) : m_pool(pool)
+{
+}
+
+uint32_t RadixSorter::FloatToKey(float value)
+{
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    // 负数翻转全部位，正数只翻转符号位
+    const uint32_t mask = (bits & 0x80000000u) ? 0xffffffffu : 0x80000000u;
+    return bits ^ mask;
+}
+
+void RadixSorter::Sort(uint32_t *keys, uint32_t *values, size_t count)
+{
+    SortImpl(keys, values, count, PASS_COUNT, m_scratchKeys);
+}
+
+void RadixSorter::Sort(uint64_t *keys, uint32_t *values, size_t count, int significantBits)
+{
+    const int bits = std::min(std::max(significantBits, 1), 64);
+    SortImpl(keys, values, count, (bits + RADIX_BITS - 1) / RADIX_BITS, m_scratchKeys64);
+}
+
+template <typename Key>
+void RadixSorter::SortImpl(Key *keys, uint32_t *values, size_t count, int passCount, std::vector<Key> &scratchKeys)
+{
+    if (count < 2)
+        return;
+
+    if (scratchKeys.size() < count)
+        scratchKeys.resize(count);
+    if (m_scratchValues.size() < count)
+        m_scratchValues.resize(count);
+
+    const size_t blockCount =
+        std::max<size_t>(1, std::min<size_t>(m_pool.GetThreadCount(), count / MIN_BLOCK_SIZE));
+    const size_t blockSize = (count + blockCount - 1) / blockCount;
+    m_histograms.assign(blockCount * BUCKET_COUNT, 0);
+
+    Key *srcKeys = keys;
+    uint32_t *srcValues = values;
+    Key *dstKeys = scratchKeys.data();
+    uint32_t *dstValues = m_scratchValues.data();
+
+    for (int pass = 0; pass < passCount; ++pass)
+    {
+        const int shift = pass * RADIX_BITS;
+
+        // 1. 各块直方图
+        m_pool.ParallelFor(0, blockCount, 1, [&](size_t blockBegin, size_t blockEnd, unsigned int) {
+            for (size_t block = blockBegin; block < blockEnd; ++block)
+            {
+                size_t *histogram = &m_histograms[block * BUCKET_COUNT];
+                std::fill(histogram, histogram + BUCKET_COUNT, 0);
+                const size_t begin = block * blockSize;
+                const size_t end = std::min(begin + blockSize, count);
+                for (size_t i = begin; i < end; ++i)
+                    ++histogram[(srcKeys[i] >> shift) & (BUCKET_COUNT - 1)];
+            }
+        });
+
+        // 2. 前缀和：桶优先、块其次，得到每块每个桶的写入起点；所有键落在同一桶时跳过本趟
+        size_t offset = 0;
+        bool trivialPass = false;
+        for (int bucket = 0; bucket < BUCKET_COUNT; ++bucket)
+        {
+            size_t bucketTotal = 0;
+            for (size_t block = 0; block < blockCount; ++block)
+            {
+                size_t &slot = m_histograms[block * BUCKET_COUNT + bucket];
+                const size_t blockCountInBucket = slot;
+                slot = offset + bucketTotal;
+                bucketTotal += blockCountInBucket;
+            }
+            if (bucketTotal == count)
+                trivialPass = true;
+            offset += bucketTotal;
+        }
+        if (trivialPass)
+            continue;
+
+        // 3. 稳定分散写出
+        m_pool.ParallelFor(0, blockCount, 1, [&](size_t blockBegin, size_t blockEnd, unsigned int) {
+            for (size_t block = blockBegin; block < blockEnd; ++block)
+            {
+                size_t *cursor = &m_histograms[block * BUCKET_COUNT];
+                const size_t begin = block * blockSize;
+                const size_t end = std::min(begin + blockSize, count);
+                for (size_t i = begin; i < end; ++i)
+                {
+                    const Key key = srcKeys[i];
+                    const size_t dst = cursor[(key >> shift) & (BUCKET_COUNT - 1)]++;
+                    dstKeys[dst] = key;
+                    dstValues[dst] = srcValues[i];
+                }
+            }
+        });
+
+        std::swap(srcKeys, dstKeys);
+        std::swap(srcValues, dstValues);
+    }
+
+    // 实际执行的趟数为奇数时结果位于临时缓冲（每趟执行后交换一次），拷回调用方数组
+    if (srcKeys != keys)
+    {
+        std::memcpy(keys, srcKeys, count * sizeof(Key));
+        std::memcpy(values, srcValues, count * sizeof(uint32_t));
+    }
+}
+
+RENDERER_NAMESPACE_END
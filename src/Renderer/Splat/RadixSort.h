@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Core/RenderCore.h"
+#include "Core/ThreadPool.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+RENDERER_NAMESPACE_BEGIN
+
+/// 多线程 LSD 基数排序：32 位或 64 位键 + 32 位载荷（高斯下标），每趟 8 位
+///
+/// 每趟将数据等分为若干块，各线程统计块内直方图 -> 串行前缀和得到每块每个桶的写入起点 ->
+/// 各线程按原顺序分散写出，保证排序稳定。所有位都相同的一趟会被跳过。
+/// 临时缓冲与直方图在多次调用间复用，逐帧排序不产生分配。
+class RENDERER_API RadixSorter
+{
+public:
+    static constexpr int RADIX_BITS = 8;
+    static constexpr int BUCKET_COUNT = 1 << RADIX_BITS;
+    static constexpr int PASS_COUNT = 32 / RADIX_BITS;
+
+    explicit RadixSorter(ThreadPool &pool = ThreadPool::Global());
+
+    RadixSorter(const RadixSorter &) = delete;
+    RadixSorter &operator=(const RadixSorter &) = delete;
+
+    /// 按键升序原地排序，values 随键一起重排
+    void Sort(uint32_t *keys, uint32_t *values, size_t count);
+    /// 64 位键版本（如 tileID << 32 | depth），只排序低 significantBits 位，高位须为 0
+    void Sort(uint64_t *keys, uint32_t *values, size_t count, int significantBits = 64);
+
+    /// float 映射为可按无符号整数比较的键（保持全序，负数同样适用）
+    static uint32_t FloatToKey(float value);
+    /// 将视空间深度量化为排序键：深度越大键越小，升序排序即得到从后往前的混合顺序
+    static uint32_t DepthToBackToFrontKey(float depth)
+    {
+        return ~FloatToKey(depth);
+    }
+
+private:
+    template <typename Key>
+    void SortImpl(Key *keys, uint32_t *values, size_t count, int passCount, std::vector<Key> &scratchKeys);
+
+    ThreadPool &m_pool;
+    std::vector<uint32_t> m_scratchKeys;
+    std::vector<uint64_t> m_scratchKeys64;
+    std::vector<uint32_t> m_scratchValues;
+    std::vector<size_t> m_histograms; // [block][bucket]
+};
+
+RENDERER_NAMESPACE_END
@@ -0,0 +1,355 @@
+#include "Splat/SHCodebook.h"
+#include "Core/CpuFeatures.h"
+#include "Core/ThreadPool.h"
+#include "Logger/Log.h"
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <random>
+#include <vector>
+
+#if RENDERER_ARCH_X86
+#include <immintrin.h>
+#endif
+
+RENDERER_NAMESPACE_BEGIN
+
+namespace
+{
+// 每个分配任务处理的样本数
+const size_t ASSIGN_GRAIN_SIZE = 1024;
+// AVX2 分配内核每次比较的码字数（一个 __m256）与同时处理的样本数
+const size_t ENTRY_BLOCK = 8;
+const size_t VECTOR_TILE = 8; // 与 FindNearestAVX2 中展开的累加器个数一致
+
+// ---- 标量内核：部分距离提前终止，按 3 个分量一组累加，超过当前最优即放弃 ----
+uint16_t FindNearestScalar(const float *entries, size_t entryCount, size_t dim, const float *vec)
+{
+    float bestDistance = std::numeric_limits<float>::max();
+    size_t best = 0;
+    for (size_t e = 0; e < entryCount; ++e)
+    {
+        const float *entry = entries + e * dim;
+        float distance = 0.0f;
+        size_t d = 0;
+        for (; d < dim && distance < bestDistance; d += 3)
+        {
+            const float dx = vec[d] - entry[d];
+            const float dy = vec[d + 1] - entry[d + 1];
+            const float dz = vec[d + 2] - entry[d + 2];
+            distance += dx * dx + dy * dy + dz * dz;
+        }
+        if (d >= dim && distance < bestDistance)
+        {
+            bestDistance = distance;
+            best = e;
+        }
+    }
+    return static_cast<uint16_t>(best);
+}
+
+#if RENDERER_ARCH_X86
+// ---- AVX2 内核：8 个样本 × 8 个码字一组，码字块内按维度转置 ----
+// 距离按 |e|^2 - 2 v·e 比较（|v|^2 对所有码字相同，可省去），每个码字块的分量只载入一次供 8 个样本复用
+RENDERER_TARGET_AVX2 void FindNearestAVX2(const float *blocks, const float *norms, size_t blockCount, size_t dim,
+                                          const float *vectors, size_t vectorCount, uint16_t *out)
+{
+    const __m256i laneIndex = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i blockStep = _mm256_set1_epi32(static_cast<int>(ENTRY_BLOCK));
+
+    for (size_t v0 = 0; v0 < vectorCount; v0 += VECTOR_TILE)
+    {
+        // 尾部不足一组时重复最后一个样本，多算的结果直接丢弃
+        const size_t tile = std::min(VECTOR_TILE, vectorCount - v0);
+        const float *rows[VECTOR_TILE];
+        __m256 bestDistance[VECTOR_TILE];
+        __m256i bestIndex[VECTOR_TILE];
+        for (size_t t = 0; t < VECTOR_TILE; ++t)
+        {
+            rows[t] = vectors + (v0 + std::min(t, tile - 1)) * dim;
+            bestDistance[t] = _mm256_set1_ps(std::numeric_limits<float>::max());
+            bestIndex[t] = _mm256_setzero_si256();
+        }
+
+        __m256i index = laneIndex;
+        for (size_t b = 0; b < blockCount; ++b)
+        {
+            // 8 个累加器显式展开，保证常驻寄存器
+            const float *block = blocks + b * dim * ENTRY_BLOCK;
+            __m256 dot0 = _mm256_setzero_ps(), dot1 = dot0, dot2 = dot0, dot3 = dot0;
+            __m256 dot4 = dot0, dot5 = dot0, dot6 = dot0, dot7 = dot0;
+            for (size_t d = 0; d < dim; ++d)
+            {
+                const __m256 entry = _mm256_loadu_ps(block + d * ENTRY_BLOCK);
+                dot0 = _mm256_add_ps(dot0, _mm256_mul_ps(entry, _mm256_broadcast_ss(rows[0] + d)));
+                dot1 = _mm256_add_ps(dot1, _mm256_mul_ps(entry, _mm256_broadcast_ss(rows[1] + d)));
+                dot2 = _mm256_add_ps(dot2, _mm256_mul_ps(entry, _mm256_broadcast_ss(rows[2] + d)));
+                dot3 = _mm256_add_ps(dot3, _mm256_mul_ps(entry, _mm256_broadcast_ss(rows[3] + d)));
+                dot4 = _mm256_add_ps(dot4, _mm256_mul_ps(entry, _mm256_broadcast_ss(rows[4] + d)));
+                dot5 = _mm256_add_ps(dot5, _mm256_mul_ps(entry, _mm256_broadcast_ss(rows[5] + d)));
+                dot6 = _mm256_add_ps(dot6, _mm256_mul_ps(entry, _mm256_broadcast_ss(rows[6] + d)));
+                dot7 = _mm256_add_ps(dot7, _mm256_mul_ps(entry, _mm256_broadcast_ss(rows[7] + d)));
+            }
+            const __m256 dot[VECTOR_TILE] = {dot0, dot1, dot2, dot3, dot4, dot5, dot6, dot7};
+
+            const __m256 norm = _mm256_loadu_ps(norms + b * ENTRY_BLOCK);
+            for (size_t t = 0; t < VECTOR_TILE; ++t)
+            {
+                const __m256 distance = _mm256_sub_ps(norm, _mm256_add_ps(dot[t], dot[t]));
+                const __m256 closer = _mm256_cmp_ps(distance, bestDistance[t], _CMP_LT_OQ);
+                bestDistance[t] = _mm256_blendv_ps(bestDistance[t], distance, closer);
+                bestIndex[t] = _mm256_castps_si256(
+                    _mm256_blendv_ps(_mm256_castsi256_ps(bestIndex[t]), _mm256_castsi256_ps(index), closer));
+            }
+            index = _mm256_add_epi32(index, blockStep);
+        }
+
+        // 8 个通道各自的最优中取距离最小者，距离相同取下标较小者
+        for (size_t t = 0; t < tile; ++t)
+        {
+            alignas(32) float distances[ENTRY_BLOCK];
+            alignas(32) int32_t indices[ENTRY_BLOCK];
+            _mm256_store_ps(distances, bestDistance[t]);
+            _mm256_store_si256(reinterpret_cast<__m256i *>(indices), bestIndex[t]);
+            size_t lane = 0;
+            for (size_t l = 1; l < ENTRY_BLOCK; ++l)
+            {
+                if (distances[l] < distances[lane] || (distances[l] == distances[lane] && indices[l] < indices[lane]))
+                    lane = l;
+            }
+            out[v0 + t] = static_cast<uint16_t>(indices[lane]);
+        }
+    }
+}
+#endif // RENDERER_ARCH_X86
+
+/// 最近码字查找，构造时按当前码字准备 AVX2 内核所需的转置分块与 |e|^2
+///
+/// 分块布局为 [块][维度][ENTRY_BLOCK]，码字数补齐到 ENTRY_BLOCK 的倍数；
+/// 补齐码字的分量为 0、|e|^2 为 FLT_MAX，距离恒为 FLT_MAX，不会被选中。
+class NearestEntrySearch
+{
+public:
+    NearestEntrySearch(const float *entries, size_t entryCount, size_t dim)
+        : m_entries(entries), m_entryCount(entryCount), m_dim(dim),
+          m_useAVX2(CpuFeatures::GetSIMDLevel() == CpuFeatures::SIMDLevel::AVX2)
+    {
+        if (!m_useAVX2)
+            return;
+        const size_t blockCount = (entryCount + ENTRY_BLOCK - 1) / ENTRY_BLOCK;
+        m_blocks.assign(blockCount * ENTRY_BLOCK * dim, 0.0f);
+        m_norms.assign(blockCount * ENTRY_BLOCK, std::numeric_limits<float>::max());
+        for (size_t e = 0; e < entryCount; ++e)
+        {
+            const float *entry = entries + e * dim;
+            float *block = &m_blocks[e / ENTRY_BLOCK * ENTRY_BLOCK * dim + e % ENTRY_BLOCK];
+            float norm = 0.0f;
+            for (size_t d = 0; d < dim; ++d)
+            {
+                block[d * ENTRY_BLOCK] = entry[d];
+                norm += entry[d] * entry[d];
+            }
+            m_norms[e] = norm;
+        }
+    }
+
+    /// 为连续存放的 vectorCount 个 dim 维向量查找最近码字
+    void Find(const float *vectors, size_t vectorCount, uint16_t *out) const
+    {
+#if RENDERER_ARCH_X86
+        if (m_useAVX2)
+        {
+            FindNearestAVX2(m_blocks.data(), m_norms.data(), m_norms.size() / ENTRY_BLOCK, m_dim, vectors,
+                            vectorCount, out);
+            return;
+        }
+#endif
+        for (size_t i = 0; i < vectorCount; ++i)
+            out[i] = FindNearestScalar(m_entries, m_entryCount, m_dim, vectors + i * m_dim);
+    }
+
+private:
+    const float *m_entries;
+    size_t m_entryCount;
+    size_t m_dim;
+    bool m_useAVX2;
+    std::vector<float> m_blocks;
+    std::vector<float> m_norms;
+};
+} // namespace
+
+SHCodebook::SHCodebook()
+{
+}
+
+SHCodebook::~SHCodebook()
+{
+}
+
+void SHCodebook::GatherVector(const GaussianCloud &cloud, size_t splat, float *out) const
+{
+    const int restCoeffs = m_dimension / 3;
+    for (int channel = 0; channel < 3; ++channel)
+    {
+        for (int k = 0; k < restCoeffs; ++k)
+            out[k * 3 + channel] = cloud.GetComponent(GaussianCloud::Attribute::SHRest, channel * restCoeffs + k)[splat];
+    }
+}
+
+bool SHCodebook::Build(const GaussianCloud &cloud, const SHCodebookParams &params)
+{
+    const size_t count = cloud.GetCount();
+    m_shDegree = cloud.GetSHDegree();
+    m_dimension = GaussianCloud::GetSHRestCoeffCount(m_shDegree) * 3;
+    m_entries.reset();
+    m_indices.reset();
+    m_entryCount = 0;
+    m_count = 0;
+    if (m_dimension == 0 || count == 0)
+        return false;
+
+    auto start = std::chrono::steady_clock::now();
+    const size_t entryCount = std::max<size_t>(1, std::min({params.entryCount, MAX_ENTRIES, count}));
+    const size_t batchSize = std::max<size_t>(1, std::min(params.batchSize, count));
+    const size_t dim = static_cast<size_t>(m_dimension);
+    ThreadPool &pool = ThreadPool::Global();
+    std::mt19937 rng(params.seed);
+
+    // 1. 分层随机抽样初始化码字，保证初始码字互不相同
+    auto entries = std::make_shared<std::vector<float>>(entryCount * dim);
+    for (size_t e = 0; e < entryCount; ++e)
+    {
+        const size_t stratumBegin = e * count / entryCount;
+        const size_t stratumEnd = std::max(stratumBegin + 1, (e + 1) * count / entryCount);
+        std::uniform_int_distribution<size_t> pick(stratumBegin, stratumEnd - 1);
+        GatherVector(cloud, pick(rng), &(*entries)[e * dim]);
+    }
+
+    // 2. 小批量 k-means：并行分配，串行按计数衰减学习率更新（每批更新量仅 batchSize * dim）
+    std::vector<size_t> entryCounts(entryCount, 0);
+    std::vector<size_t> batch(batchSize);
+    std::vector<float> batchVectors(batchSize * dim);
+    std::vector<uint16_t> batchAssign(batchSize);
+    std::uniform_int_distribution<size_t> pickSplat(0, count - 1);
+
+    for (int iter = 0; iter < params.iterations; ++iter)
+    {
+        for (size_t b = 0; b < batchSize; ++b)
+            batch[b] = pickSplat(rng);
+
+        const NearestEntrySearch search(entries->data(), entryCount, dim);
+        pool.ParallelFor(0, batchSize, ASSIGN_GRAIN_SIZE, [&](size_t begin, size_t end, unsigned int) {
+            for (size_t b = begin; b < end; ++b)
+                GatherVector(cloud, batch[b], &batchVectors[b * dim]);
+            search.Find(&batchVectors[begin * dim], end - begin, &batchAssign[begin]);
+        });
+
+        for (size_t b = 0; b < batchSize; ++b)
+        {
+            const size_t e = batchAssign[b];
+            const float eta = 1.0f / static_cast<float>(++entryCounts[e]);
+            float *entry = &(*entries)[e * dim];
+            const float *vec = &batchVectors[b * dim];
+            for (size_t d = 0; d < dim; ++d)
+                entry[d] += eta * (vec[d] - entry[d]);
+        }
+    }
+
+    // 训练中从未命中的码字重新随机取样，避免浪费码本容量
+    size_t reseeded = 0;
+    for (size_t e = 0; e < entryCount; ++e)
+    {
+        if (entryCounts[e] == 0 && params.iterations > 0)
+        {
+            GatherVector(cloud, pickSplat(rng), &(*entries)[e * dim]);
+            ++reseeded;
+        }
+    }
+
+    // 3. 全量并行分配
+    auto indices = std::make_shared<std::vector<uint16_t>>(count);
+    const NearestEntrySearch search(entries->data(), entryCount, dim);
+    pool.ParallelFor(0, count, ASSIGN_GRAIN_SIZE, [&](size_t begin, size_t end, unsigned int) {
+        std::vector<float> vectors((end - begin) * dim);
+        for (size_t i = begin; i < end; ++i)
+            GatherVector(cloud, i, &vectors[(i - begin) * dim]);
+        search.Find(vectors.data(), end - begin, &(*indices)[begin]);
+    });
+
+    // 别名构造：对外只暴露只读指针，引用计数持有构建时的 vector
+    m_entries = std::shared_ptr<const float>(entries, entries->data());
+    m_indices = std::shared_ptr<const uint16_t>(indices, indices->data());
+    m_entryCount = entryCount;
+    m_count = count;
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    LOG_CORE_INFO("SHCodebook: {} splats -> {} entries x {} floats ({} reseeded), {:.2f} MB -> {:.2f} MB, {:.2f}s",
+                  count, entryCount, dim, reseeded, count * dim * sizeof(float) / (1024.0 * 1024.0),
+                  GetMemorySize() / (1024.0 * 1024.0), seconds);
+    return true;
+}
+
+bool SHCodebook::Adopt(std::shared_ptr<const float> entries, size_t entryCount,
+                       std::shared_ptr<const uint16_t> indices, size_t count, int shDegree)
+{
+    if (!entries || !indices || entryCount == 0 || entryCount > MAX_ENTRIES || shDegree < 1 ||
+        shDegree > GaussianCloud::MAX_SH_DEGREE)
+        return false;
+
+    // 下标来自外部数据，越界会让解码与着色器取数越过码本
+    const uint16_t *data = indices.get();
+    uint16_t maxIndex = 0;
+    for (size_t i = 0; i < count; ++i)
+        maxIndex = std::max(maxIndex, data[i]);
+    if (count > 0 && maxIndex >= entryCount)
+        return false;
+
+    m_entries = std::move(entries);
+    m_indices = std::move(indices);
+    m_entryCount = entryCount;
+    m_count = count;
+    m_shDegree = shDegree;
+    m_dimension = GaussianCloud::GetSHRestCoeffCount(shDegree) * 3;
+    return true;
+}
+
+std::shared_ptr<SHCodebook> SHCodebook::ReduceSHDegree(int shDegree) const
+{
+    if (shDegree < 1 || shDegree > m_shDegree || m_entryCount == 0)
+        return nullptr;
+
+    // 码字分量按 k 主序排列，低阶部分恰为每个码字的前 dimension 个 float
+    const size_t dimension = static_cast<size_t>(GaussianCloud::GetSHRestCoeffCount(shDegree)) * 3;
+    auto entries = std::make_shared<std::vector<float>>(m_entryCount * dimension);
+    for (size_t e = 0; e < m_entryCount; ++e)
+        std::copy_n(GetEntry(e), dimension, &(*entries)[e * dimension]);
+
+    auto reduced = std::make_shared<SHCodebook>();
+    if (!reduced->Adopt(std::shared_ptr<const float>(entries, entries->data()), m_entryCount, m_indices, m_count,
+                        shDegree))
+        return nullptr;
+    return reduced;
+}
+
+void SHCodebook::Decode(GaussianCloud &cloud) const
+{
+    const size_t count = std::min(cloud.GetCount(), m_count);
+    const int restCoeffs = m_dimension / 3;
+    if (cloud.GetSHDegree() != m_shDegree || restCoeffs == 0)
+        return;
+
+    ThreadPool::Global().ParallelFor(0, count, ASSIGN_GRAIN_SIZE * 16, [&](size_t begin, size_t end, unsigned int) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            const float *entry = GetEntry(GetIndex(i));
+            for (int channel = 0; channel < 3; ++channel)
+            {
+                for (int k = 0; k < restCoeffs; ++k)
+                    cloud.GetComponent(GaussianCloud::Attribute::SHRest, channel * restCoeffs + k)[i] =
+                        entry[k * 3 + channel];
+            }
+        }
+    });
+}
+
+RENDERER_NAMESPACE_END
@@ -0,0 +1,110 @@
+#pragma once
+
+#include "Core/RenderCore.h"
+#include "Splat/GaussianCloud.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+RENDERER_NAMESPACE_BEGIN
+
+/// 码本构建参数
+struct SHCodebookParams
+{
+    size_t entryCount = 4096; // 码本大小，上限 SHCodebook::MAX_ENTRIES
+    size_t batchSize = 8192;  // 每轮抽样数
+    int iterations = 32;      // 小批量迭代轮数
+    unsigned int seed = 42;
+};
+
+/// 高阶球谐系数（f_rest）的向量量化码本
+///
+/// 将每个高斯的 restCoeffCount * 3 维 SH 向量聚类为 entryCount 个码字，高斯只保存 16 位码字下标。
+/// 码本由小批量 k-means（mini-batch k-means）构建：每轮随机抽取一批样本并行分配到最近码字，
+/// 再按样本计数衰减的学习率更新码字；最后对全部高斯并行做一次最近码字分配。
+/// 最近码字查找在 AVX2 下以码本转置分块、一次比较 8 个码字 × 8 个样本，否则走带部分距离提前终止的标量路径。
+///
+/// 码字与下标以 shared_ptr 持有，可通过 Adopt() 直接接管 .gsc 缓存映射区中的数据而不拷贝。
+///
+/// 码字内分量顺序为 d = (k - 1) * 3 + channel（k = 1..restCoeffCount），与着色器端取数顺序一致。
+class RENDERER_API SHCodebook
+{
+public:
+    static constexpr size_t MAX_ENTRIES = 65536;
+
+    SHCodebook();
+    ~SHCodebook();
+
+    SHCodebook(const SHCodebook &) = delete;
+    SHCodebook &operator=(const SHCodebook &) = delete;
+
+    /// 为点云的 f_rest 构建码本并为每个高斯分配码字，SH 阶数为 0 时返回 false
+    bool Build(const GaussianCloud &cloud, const SHCodebookParams &params = SHCodebookParams());
+    /// 接管外部存储中的码字（entryCount * 维度个 float）与下标（count 个），不拷贝；
+    /// 下标越界或参数无效时返回 false。shared_ptr 负责保持数据有效（如别名指向映射文件）
+    bool Adopt(std::shared_ptr<const float> entries, size_t entryCount, std::shared_ptr<const uint16_t> indices,
+               size_t count, int shDegree);
+    /// 降到较低的 SH 阶数：码字只保留低阶分量（码字拷贝），下标与原码本共享；shDegree 为 0 时返回空
+    std::shared_ptr<SHCodebook> ReduceSHDegree(int shDegree) const;
+    /// 将码字写回点云的 SHRest 属性（点云数量与阶数须与构建时一致）
+    void Decode(GaussianCloud &cloud) const;
+
+    size_t GetEntryCount() const
+    {
+        return m_entryCount;
+    }
+    /// 每个码字的 float 个数（restCoeffCount * 3）
+    int GetDimension() const
+    {
+        return m_dimension;
+    }
+    int GetSHDegree() const
+    {
+        return m_shDegree;
+    }
+    size_t GetCount() const
+    {
+        return m_count;
+    }
+
+    const float *GetEntry(size_t entry) const
+    {
+        return m_entries.get() + entry * m_dimension;
+    }
+    uint16_t GetIndex(size_t splat) const
+    {
+        return m_indices.get()[splat];
+    }
+
+    // ---- GPU 上传用的原始数据 ----
+    const float *GetEntryData() const
+    {
+        return m_entries.get();
+    }
+    size_t GetEntryDataSize() const
+    {
+        return m_entryCount * m_dimension * sizeof(float);
+    }
+    const uint16_t *GetIndexData() const
+    {
+        return m_indices.get();
+    }
+
+    /// 码本 + 下标的总字节数
+    size_t GetMemorySize() const
+    {
+        return GetEntryDataSize() + m_count * sizeof(uint16_t);
+    }
+
+private:
+    void GatherVector(const GaussianCloud &cloud, size_t splat, float *out) const;
+
+    std::shared_ptr<const float> m_entries;
+    std::shared_ptr<const uint16_t> m_indices;
+    size_t m_entryCount = 0;
+    size_t m_count = 0;
+    int m_dimension = 0;
+    int m_shDegree = 0;
+};
+
+RENDERER_NAMESPACE_END
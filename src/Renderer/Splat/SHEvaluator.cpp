@@ -0,0 +1,266 @@
+#include "Splat/SHEvaluator.h"
+#include <algorithm>
+#include <cmath>
+
+#if RENDERER_ARCH_X86
+#include <immintrin.h>
+#endif
+
+RENDERER_NAMESPACE_BEGIN
+
+namespace
+{
+// ---- 球谐常数（与 splat_common.glsl 一致） ----
+const float SH_C0 = 0.28209479177387814f;
+const float SH_C1 = 0.4886025119029199f;
+const float SH_C2[5] = {1.0925484305920792f, -1.0925484305920792f, 0.31539156525252005f, -1.0925484305920792f,
+                        0.5462742152960396f};
+const float SH_C3[7] = {-0.5900435899266435f, 2.890611442640554f, -0.4570457994644658f, 0.3731763325901154f,
+                        -0.4570457994644658f, 1.445305721320277f, -0.5900435899266435f};
+const int MAX_BASIS = 15;
+
+/// 按 SHRest 的系数序号 k 计算基函数值（k = 0 为 1 阶第一项），返回基函数个数
+inline int EvaluateSHBasis(int degree, float x, float y, float z, float *basis)
+{
+    int n = 0;
+    if (degree > 0)
+    {
+        basis[n++] = -SH_C1 * y;
+        basis[n++] = SH_C1 * z;
+        basis[n++] = -SH_C1 * x;
+    }
+    if (degree > 1)
+    {
+        const float xx = x * x, yy = y * y, zz = z * z;
+        basis[n++] = SH_C2[0] * x * y;
+        basis[n++] = SH_C2[1] * y * z;
+        basis[n++] = SH_C2[2] * (2.0f * zz - xx - yy);
+        basis[n++] = SH_C2[3] * x * z;
+        basis[n++] = SH_C2[4] * (xx - yy);
+        if (degree > 2)
+        {
+            basis[n++] = SH_C3[0] * y * (3.0f * xx - yy);
+            basis[n++] = SH_C3[1] * x * y * z;
+            basis[n++] = SH_C3[2] * y * (4.0f * zz - xx - yy);
+            basis[n++] = SH_C3[3] * z * (2.0f * zz - 3.0f * xx - 3.0f * yy);
+            basis[n++] = SH_C3[4] * x * (4.0f * zz - xx - yy);
+            basis[n++] = SH_C3[5] * z * (xx - yy);
+            basis[n++] = SH_C3[6] * x * (xx - 3.0f * yy);
+        }
+    }
+    return n;
+}
+
+// ---- 标量内核：兼作 SIMD 路径的尾部处理 ----
+inline void EvaluateOne(const SHColorSource &src, const float *camera, int degree, size_t i, float *const *rgb)
+{
+    float dir[3];
+    for (int c = 0; c < 3; ++c)
+        dir[c] = src.position[c][i] - camera[c];
+    const float length = std::sqrt(dir[0] * dir[0] + dir[1] * dir[1] + dir[2] * dir[2]);
+    const float invLength = length > 0.0f ? 1.0f / length : 0.0f;
+    float basis[MAX_BASIS];
+    const int basisCount = EvaluateSHBasis(degree, dir[0] * invLength, dir[1] * invLength, dir[2] * invLength, basis);
+    for (int channel = 0; channel < 3; ++channel)
+    {
+        const float *rest = src.shRest + static_cast<size_t>(channel) * src.restCoeffCount * src.count + i;
+        float value = SH_C0 * src.shDC[channel][i];
+        for (int k = 0; k < basisCount; ++k)
+            value += basis[k] * rest[static_cast<size_t>(k) * src.count];
+        rgb[channel][i] = std::max(value + 0.5f, 0.0f);
+    }
+}
+
+void EvaluateScalar(const SHColorSource &src, const float *camera, int degree, size_t begin, size_t end,
+                    float *const *rgb)
+{
+    for (size_t i = begin; i < end; ++i)
+        EvaluateOne(src, camera, degree, i, rgb);
+}
+
+#if RENDERER_ARCH_X86
+
+// 各宽度共用的基函数展开：x, y, z 为单位方向，结果写入 basis[0..n)
+#define SH_BASIS_SIMD(MUL, ADD, SUB, SET1, x, y, z, degree, basis, n)                                                \
+    do                                                                                                              \
+    {                                                                                                               \
+        n = 0;                                                                                                      \
+        if (degree > 0)                                                                                             \
+        {                                                                                                           \
+            basis[n++] = MUL(SET1(-SH_C1), y);                                                                      \
+            basis[n++] = MUL(SET1(SH_C1), z);                                                                       \
+            basis[n++] = MUL(SET1(-SH_C1), x);                                                                      \
+        }                                                                                                           \
+        if (degree > 1)                                                                                             \
+        {                                                                                                           \
+            const auto xx = MUL(x, x), yy = MUL(y, y), zz = MUL(z, z);                                              \
+            const auto xy = MUL(x, y);                                                                              \
+            const auto xxMinusYy = SUB(xx, yy);                                                                     \
+            const auto xxPlusYy = ADD(xx, yy);                                                                      \
+            basis[n++] = MUL(SET1(SH_C2[0]), xy);                                                                   \
+            basis[n++] = MUL(SET1(SH_C2[1]), MUL(y, z));                                                            \
+            basis[n++] = MUL(SET1(SH_C2[2]), SUB(MUL(SET1(2.0f), zz), xxPlusYy));                                   \
+            basis[n++] = MUL(SET1(SH_C2[3]), MUL(x, z));                                                            \
+            basis[n++] = MUL(SET1(SH_C2[4]), xxMinusYy);                                                            \
+            if (degree > 2)                                                                                         \
+            {                                                                                                       \
+                const auto fourZzMinus = SUB(MUL(SET1(4.0f), zz), xxPlusYy);                                        \
+                basis[n++] = MUL(SET1(SH_C3[0]), MUL(y, SUB(MUL(SET1(3.0f), xx), yy)));                             \
+                basis[n++] = MUL(SET1(SH_C3[1]), MUL(xy, z));                                                       \
+                basis[n++] = MUL(SET1(SH_C3[2]), MUL(y, fourZzMinus));                                              \
+                basis[n++] = MUL(SET1(SH_C3[3]), MUL(z, SUB(MUL(SET1(2.0f), zz), MUL(SET1(3.0f), xxPlusYy))));      \
+                basis[n++] = MUL(SET1(SH_C3[4]), MUL(x, fourZzMinus));                                              \
+                basis[n++] = MUL(SET1(SH_C3[5]), MUL(z, xxMinusYy));                                                \
+                basis[n++] = MUL(SET1(SH_C3[6]), MUL(x, SUB(xx, MUL(SET1(3.0f), yy))));                             \
+            }                                                                                                       \
+        }                                                                                                           \
+    } while (0)
+
+// ---- SSE4.1 内核：每次迭代 4 路 ----
+RENDERER_TARGET_SSE41 void EvaluateBatchSSE4(const SHColorSource &src, const float *camera, int degree,
+                                              size_t begin, size_t end, float *const *rgb)
+{
+    const __m128 camX = _mm_set1_ps(camera[0]), camY = _mm_set1_ps(camera[1]), camZ = _mm_set1_ps(camera[2]);
+    const __m128 zero = _mm_setzero_ps(), one = _mm_set1_ps(1.0f), half = _mm_set1_ps(0.5f);
+    const __m128 c0 = _mm_set1_ps(SH_C0);
+    const size_t channelStride = static_cast<size_t>(src.restCoeffCount) * src.count;
+
+    size_t i = begin;
+    for (; i + 4 <= end; i += 4)
+    {
+        __m128 x = _mm_sub_ps(_mm_loadu_ps(src.position[0] + i), camX);
+        __m128 y = _mm_sub_ps(_mm_loadu_ps(src.position[1] + i), camY);
+        __m128 z = _mm_sub_ps(_mm_loadu_ps(src.position[2] + i), camZ);
+        const __m128 length =
+            _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y)), _mm_mul_ps(z, z)));
+        const __m128 invLength = _mm_and_ps(_mm_div_ps(one, length), _mm_cmpgt_ps(length, zero));
+        x = _mm_mul_ps(x, invLength);
+        y = _mm_mul_ps(y, invLength);
+        z = _mm_mul_ps(z, invLength);
+
+        __m128 basis[MAX_BASIS];
+        int basisCount;
+        SH_BASIS_SIMD(_mm_mul_ps, _mm_add_ps, _mm_sub_ps, _mm_set1_ps, x, y, z, degree, basis, basisCount);
+
+        for (int channel = 0; channel < 3; ++channel)
+        {
+            const float *rest = src.shRest + channel * channelStride + i;
+            __m128 value = _mm_mul_ps(c0, _mm_loadu_ps(src.shDC[channel] + i));
+            for (int k = 0; k < basisCount; ++k)
+                value = _mm_add_ps(value, _mm_mul_ps(basis[k], _mm_loadu_ps(rest + static_cast<size_t>(k) * src.count)));
+            _mm_storeu_ps(rgb[channel] + i, _mm_max_ps(_mm_add_ps(value, half), zero));
+        }
+    }
+    EvaluateScalar(src, camera, degree, i, end, rgb);
+}
+
+// ---- AVX2 内核：每次迭代 8 路 ----
+RENDERER_TARGET_AVX2 void EvaluateBatchAVX2(const SHColorSource &src, const float *camera, int degree,
+                                             size_t begin, size_t end, float *const *rgb)
+{
+    const __m256 camX = _mm256_set1_ps(camera[0]), camY = _mm256_set1_ps(camera[1]), camZ = _mm256_set1_ps(camera[2]);
+    const __m256 zero = _mm256_setzero_ps(), one = _mm256_set1_ps(1.0f), half = _mm256_set1_ps(0.5f);
+    const __m256 c0 = _mm256_set1_ps(SH_C0);
+    const size_t channelStride = static_cast<size_t>(src.restCoeffCount) * src.count;
+
+    size_t i = begin;
+    for (; i + 8 <= end; i += 8)
+    {
+        __m256 x = _mm256_sub_ps(_mm256_loadu_ps(src.position[0] + i), camX);
+        __m256 y = _mm256_sub_ps(_mm256_loadu_ps(src.position[1] + i), camY);
+        __m256 z = _mm256_sub_ps(_mm256_loadu_ps(src.position[2] + i), camZ);
+        const __m256 length = _mm256_sqrt_ps(
+            _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, x), _mm256_mul_ps(y, y)), _mm256_mul_ps(z, z)));
+        const __m256 invLength = _mm256_and_ps(_mm256_div_ps(one, length), _mm256_cmp_ps(length, zero, _CMP_GT_OQ));
+        x = _mm256_mul_ps(x, invLength);
+        y = _mm256_mul_ps(y, invLength);
+        z = _mm256_mul_ps(z, invLength);
+
+        __m256 basis[MAX_BASIS];
+        int basisCount;
+        SH_BASIS_SIMD(_mm256_mul_ps, _mm256_add_ps, _mm256_sub_ps, _mm256_set1_ps, x, y, z, degree, basis,
+                      basisCount);
+
+        for (int channel = 0; channel < 3; ++channel)
+        {
+            const float *rest = src.shRest + channel * channelStride + i;
+            __m256 value = _mm256_mul_ps(c0, _mm256_loadu_ps(src.shDC[channel] + i));
+            for (int k = 0; k < basisCount; ++k)
+                value = _mm256_add_ps(value,
+                                      _mm256_mul_ps(basis[k], _mm256_loadu_ps(rest + static_cast<size_t>(k) * src.count)));
+            _mm256_storeu_ps(rgb[channel] + i, _mm256_max_ps(_mm256_add_ps(value, half), zero));
+        }
+    }
+    EvaluateBatchSSE4(src, camera, degree, i, end, rgb);
+}
+
+#undef SH_BASIS_SIMD
+
+#endif // RENDERER_ARCH_X86
+} // namespace
+
+SHEvaluator::SHEvaluator() : m_level(CpuFeatures::GetSIMDLevel())
+{
+}
+
+SHColorSource SHEvaluator::MakeSource(const GaussianCloud &cloud)
+{
+    SHColorSource source;
+    for (int c = 0; c < 3; ++c)
+    {
+        source.position[c] = cloud.GetComponent(GaussianCloud::Attribute::Position, c);
+        source.shDC[c] = cloud.GetComponent(GaussianCloud::Attribute::SHDC, c);
+    }
+    source.shRest = cloud.GetAttribute(GaussianCloud::Attribute::SHRest);
+    source.count = cloud.GetCount();
+    source.restCoeffCount = GaussianCloud::GetSHRestCoeffCount(cloud.GetSHDegree());
+    source.shDegree = cloud.GetSHDegree();
+    return source;
+}
+
+void SHEvaluator::GetCameraPosition(const float *viewMatrix, float *cameraPosition)
+{
+    // 列主序：R 第 r 行第 c 列位于 viewMatrix[c * 4 + r]
+    for (int c = 0; c < 3; ++c)
+        cameraPosition[c] = -(viewMatrix[c * 4 + 0] * viewMatrix[12] + viewMatrix[c * 4 + 1] * viewMatrix[13] +
+                              viewMatrix[c * 4 + 2] * viewMatrix[14]);
+}
+
+void SHEvaluator::SetCamera(const float *cameraPosition)
+{
+    for (int c = 0; c < 3; ++c)
+        m_camera[c] = cameraPosition[c];
+}
+
+void SHEvaluator::SetSIMDLevel(CpuFeatures::SIMDLevel level)
+{
+    m_level = std::min(level, CpuFeatures::GetSIMDLevel());
+}
+
+void SHEvaluator::Evaluate(const SHColorSource &source, int degree, size_t begin, size_t end, float *const *rgb) const
+{
+    degree = std::max(0, std::min(degree, source.shDegree));
+#if RENDERER_ARCH_X86
+    if (m_level == CpuFeatures::SIMDLevel::AVX2)
+    {
+        EvaluateBatchAVX2(source, m_camera, degree, begin, end, rgb);
+        return;
+    }
+    if (m_level == CpuFeatures::SIMDLevel::SSE41)
+    {
+        EvaluateBatchSSE4(source, m_camera, degree, begin, end, rgb);
+        return;
+    }
+#endif
+    EvaluateScalar(source, m_camera, degree, begin, end, rgb);
+}
+
+void SHEvaluator::EvaluateIndexed(const SHColorSource &source, int degree, const uint32_t *indices,
+                                  size_t indexCount, float *const *rgb) const
+{
+    degree = std::max(0, std::min(degree, source.shDegree));
+    for (size_t k = 0; k < indexCount; ++k)
+        EvaluateOne(source, m_camera, degree, indices[k], rgb);
+}
+
+RENDERER_NAMESPACE_END
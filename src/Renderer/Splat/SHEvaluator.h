@@ -0,0 +1,57 @@
+#pragma once
+
+#include "Core/CpuFeatures.h"
+#include "Core/RenderCore.h"
+#include "Splat/GaussianCloud.h"
+#include <cstddef>
+#include <cstdint>
+
+RENDERER_NAMESPACE_BEGIN
+
+/// 球谐颜色求值读取的点云平面
+struct SHColorSource
+{
+    const float *position[3] = {nullptr, nullptr, nullptr};
+    const float *shDC[3] = {nullptr, nullptr, nullptr};
+    const float *shRest = nullptr; // SHRest 属性段首地址，系数 (channel, k) 的平面位于 (channel * restCoeffCount + k) * count
+    size_t count = 0;              // 平面长度（点云高斯数）
+    int restCoeffCount = 0;        // 点云每通道的高阶系数个数
+    int shDegree = 0;              // 点云的球谐阶数
+};
+
+/// 批量球谐颜色求值：color = max(Σ SH(dir) · coeff + 0.5, 0)，dir 为相机指向高斯中心的单位向量
+///
+/// 与 splat_common.glsl 的 evaluateSplatSH 数学一致。输入为 SoA 系数平面，
+/// 视线方向在内核中由相机位置与高斯位置逐路计算并归一化，每次迭代处理 8 个高斯；
+/// 运行时选择 AVX2 / SSE4.1 / 标量内核。三阶时每通道每高斯 16 次乘加。
+class RENDERER_API SHEvaluator
+{
+public:
+    SHEvaluator();
+
+    static SHColorSource MakeSource(const GaussianCloud &cloud);
+    /// 由列主序视图矩阵求相机世界坐标：-Rᵀ·t
+    static void GetCameraPosition(const float *viewMatrix, float *cameraPosition);
+
+    void SetCamera(const float *cameraPosition);
+
+    /// 求 [begin, end) 区间高斯的颜色，写入 rgb 三个平面的相同下标
+    /// @param degree 求值阶数，超过点云阶数时按点云阶数
+    void Evaluate(const SHColorSource &source, int degree, size_t begin, size_t end, float *const *rgb) const;
+    /// 只求 indices 中列出的高斯（非连续下标，标量路径），结果写入 rgb 的原始下标
+    void EvaluateIndexed(const SHColorSource &source, int degree, const uint32_t *indices, size_t indexCount,
+                         float *const *rgb) const;
+
+    /// 强制指定内核（用于对比测试），不支持的等级会自动降级
+    void SetSIMDLevel(CpuFeatures::SIMDLevel level);
+    CpuFeatures::SIMDLevel GetSIMDLevel() const
+    {
+        return m_level;
+    }
+
+private:
+    float m_camera[3] = {0.0f, 0.0f, 0.0f};
+    CpuFeatures::SIMDLevel m_level;
+};
+
+RENDERER_NAMESPACE_END
@@ -0,0 +1,193 @@
+#include "Splat/SplatChunkSet.h"
+#include <algorithm>
+#include <numeric>
+
+RENDERER_NAMESPACE_BEGIN
+
+namespace
+{
+// 区间 [begin, end) 的中心包围盒
+void ComputeCenterBounds(const float *const position[3], const uint32_t *indices, size_t begin, size_t end,
+                         float *boundsMin, float *boundsMax)
+{
+    for (int c = 0; c < 3; ++c)
+    {
+        boundsMin[c] = position[c][indices[begin]];
+        boundsMax[c] = boundsMin[c];
+    }
+    for (size_t k = begin + 1; k < end; ++k)
+    {
+        const uint32_t i = indices[k];
+        for (int c = 0; c < 3; ++c)
+        {
+            boundsMin[c] = std::min(boundsMin[c], position[c][i]);
+            boundsMax[c] = std::max(boundsMax[c], position[c][i]);
+        }
+    }
+}
+
+struct SplitRange
+{
+    size_t begin;
+    size_t end;
+};
+
+// Morton 序点云：在 Morton 码最高的不同位处二分（即八叉树的格子边界），块包围盒不会跨越大的空间跳变；
+// 之后把过小的相邻叶子合并，使块大小尽量落在 [chunkSize / 2, chunkSize]
+void SplitMortonLeaves(const GaussianCloud &cloud, size_t chunkSize, std::vector<SplitRange> &leaves)
+{
+    const size_t count = cloud.GetCount();
+    std::vector<uint32_t> codes(count);
+    cloud.ComputeMortonCodes(codes.data());
+
+    std::vector<SplitRange> cells;
+    std::vector<SplitRange> stack{{0, count}};
+    while (!stack.empty())
+    {
+        const SplitRange range = stack.back();
+        stack.pop_back();
+        if (range.end - range.begin <= chunkSize)
+        {
+            cells.push_back(range);
+            continue;
+        }
+
+        size_t mid = range.begin + (range.end - range.begin) / 2;
+        const uint32_t diff = codes[range.begin] ^ codes[range.end - 1];
+        if (diff != 0)
+        {
+            uint32_t highBit = 1u << 31;
+            while ((diff & highBit) == 0)
+                highBit >>= 1;
+            // 区间已按码升序，该位为 1 的第一个位置即切分点
+            mid = static_cast<size_t>(std::partition_point(codes.begin() + range.begin, codes.begin() + range.end,
+                                                           [highBit](uint32_t code) { return (code & highBit) == 0; }) -
+                                      codes.begin());
+        }
+        // 后压入左半，保证叶子按下标顺序弹出
+        stack.push_back({mid, range.end});
+        stack.push_back({range.begin, mid});
+    }
+
+    const size_t minSize = chunkSize / 2;
+    for (const SplitRange &cell : cells)
+    {
+        if (!leaves.empty() && leaves.back().end - leaves.back().begin < minSize &&
+            cell.end - leaves.back().begin <= chunkSize)
+            leaves.back().end = cell.end;
+        else
+            leaves.push_back(cell);
+    }
+}
+} // namespace
+
+SplatChunkSet::SplatChunkSet(ThreadPool &pool) : m_pool(pool)
+{
+}
+
+void SplatChunkSet::Clear()
+{
+    m_chunks.clear();
+    m_indices.clear();
+    m_contiguous = false;
+}
+
+void SplatChunkSet::Build(const GaussianCloud &cloud, size_t chunkSize)
+{
+    Clear();
+    const size_t count = cloud.GetCount();
+    if (count == 0)
+        return;
+    chunkSize = std::min(std::max(chunkSize, MIN_CHUNK_SIZE), MAX_CHUNK_SIZE);
+
+    const float *position[3];
+    const float *scale[3];
+    for (int c = 0; c < 3; ++c)
+    {
+        position[c] = cloud.GetComponent(GaussianCloud::Attribute::Position, c);
+        scale[c] = cloud.GetComponent(GaussianCloud::Attribute::Scale, c);
+    }
+
+    m_indices.resize(count);
+    std::iota(m_indices.begin(), m_indices.end(), 0u);
+    uint32_t *indices = m_indices.data();
+
+    std::vector<SplitRange> leaves;
+    if (cloud.IsMortonOrdered())
+    {
+        SplitMortonLeaves(cloud, chunkSize, leaves);
+        m_contiguous = true;
+    }
+    else
+    {
+        // 逐层切分：同一层的各区间互不重叠，可并行；区间数随层数翻倍，顶层几层主要靠 nth_element 本身
+        std::vector<SplitRange> level{{0, count}};
+        while (!level.empty())
+        {
+            std::vector<SplitRange> next(level.size() * 2);
+            std::vector<uint8_t> split(level.size(), 0);
+            m_pool.ParallelFor(0, level.size(), 1, [&](size_t rangeBegin, size_t rangeEnd, unsigned int) {
+                for (size_t r = rangeBegin; r < rangeEnd; ++r)
+                {
+                    const SplitRange range = level[r];
+                    if (range.end - range.begin <= chunkSize)
+                        continue;
+
+                    float boundsMin[3];
+                    float boundsMax[3];
+                    ComputeCenterBounds(position, indices, range.begin, range.end, boundsMin, boundsMax);
+                    int axis = 0;
+                    for (int c = 1; c < 3; ++c)
+                    {
+                        if (boundsMax[c] - boundsMin[c] > boundsMax[axis] - boundsMin[axis])
+                            axis = c;
+                    }
+                    const float *key = position[axis];
+                    const size_t mid = range.begin + (range.end - range.begin) / 2;
+                    std::nth_element(indices + range.begin, indices + mid, indices + range.end,
+                                     [key](uint32_t a, uint32_t b) { return key[a] < key[b]; });
+                    next[r * 2] = {range.begin, mid};
+                    next[r * 2 + 1] = {mid, range.end};
+                    split[r] = 1;
+                }
+            });
+
+            std::vector<SplitRange> nextLevel;
+            for (size_t r = 0; r < level.size(); ++r)
+            {
+                if (split[r])
+                {
+                    nextLevel.push_back(next[r * 2]);
+                    nextLevel.push_back(next[r * 2 + 1]);
+                }
+                else
+                {
+                    leaves.push_back(level[r]);
+                }
+            }
+            level.swap(nextLevel);
+        }
+    }
+
+    // 叶子按下标区间排序，块在 m_indices 中首尾相接
+    std::sort(leaves.begin(), leaves.end(), [](const SplitRange &a, const SplitRange &b) { return a.begin < b.begin; });
+    m_chunks.resize(leaves.size());
+    m_pool.ParallelFor(0, leaves.size(), 64, [&](size_t chunkBegin, size_t chunkEnd, unsigned int) {
+        for (size_t k = chunkBegin; k < chunkEnd; ++k)
+        {
+            SplatChunk &chunk = m_chunks[k];
+            chunk.begin = static_cast<uint32_t>(leaves[k].begin);
+            chunk.count = static_cast<uint32_t>(leaves[k].end - leaves[k].begin);
+            ComputeCenterBounds(position, indices, leaves[k].begin, leaves[k].end, chunk.boundsMin, chunk.boundsMax);
+            float maxScale = 0.0f;
+            for (size_t j = leaves[k].begin; j < leaves[k].end; ++j)
+            {
+                const uint32_t i = indices[j];
+                maxScale = std::max(maxScale, std::max(scale[0][i], std::max(scale[1][i], scale[2][i])));
+            }
+            chunk.maxExtent = 3.0f * maxScale;
+        }
+    });
+}
+
+RENDERER_NAMESPACE_END
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Core/RenderCore.h"
+#include "Core/ThreadPool.h"
+#include "Splat/GaussianCloud.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+RENDERER_NAMESPACE_BEGIN
+
+/// 一个空间连续的高斯分块
+struct SplatChunk
+{
+    float boundsMin[3] = {0.0f, 0.0f, 0.0f}; // 块内高斯中心的包围盒
+    float boundsMax[3] = {0.0f, 0.0f, 0.0f};
+    float maxExtent = 0.0f; // 块内最大的 3σ 半径（3 · 最大缩放），包围盒外扩该值即包住所有高斯
+    uint32_t begin = 0;     // 在 SplatChunkSet::GetIndices() 中的区间 [begin, begin + count)
+    uint32_t count = 0;
+};
+
+/// 点云的空间分块：沿包围盒最长轴递归中位数切分，直到每块不超过 chunkSize 个高斯
+///
+/// 叶子块大小落在 [chunkSize / 2, chunkSize]，块内高斯下标连续存放在 GetIndices() 中。
+/// 点云已按 Morton 序排列时改为在 Morton 码的格子边界处切分连续下标区间，GetIndices() 即恒等映射。
+/// 加载点云后构建一次，SplatCuller 先按块做视锥剔除，整块在视锥内时跳过逐高斯的视锥判定。
+class RENDERER_API SplatChunkSet
+{
+public:
+    static constexpr size_t DEFAULT_CHUNK_SIZE = 1024;
+    static constexpr size_t MIN_CHUNK_SIZE = 256;
+    static constexpr size_t MAX_CHUNK_SIZE = 4096;
+
+    explicit SplatChunkSet(ThreadPool &pool = ThreadPool::Global());
+
+    /// 按当前点云构建分块，chunkSize 会被限制到 [MIN_CHUNK_SIZE, MAX_CHUNK_SIZE]
+    void Build(const GaussianCloud &cloud, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+    void Clear();
+
+    bool IsEmpty() const
+    {
+        return m_chunks.empty();
+    }
+    const std::vector<SplatChunk> &GetChunks() const
+    {
+        return m_chunks;
+    }
+    /// 按块排列的高斯下标，长度等于点云高斯数
+    const std::vector<uint32_t> &GetIndices() const
+    {
+        return m_indices;
+    }
+    /// 块是否为点云中连续的下标区间（GetIndices()[k] == k）
+    bool IsContiguous() const
+    {
+        return m_contiguous;
+    }
+    /// 构建时的高斯数，用于检查与点云是否匹配
+    size_t GetSplatCount() const
+    {
+        return m_indices.size();
+    }
+
+private:
+    ThreadPool &m_pool;
+    std::vector<SplatChunk> m_chunks;
+    std::vector<uint32_t> m_indices;
+    bool m_contiguous = false;
+};
+
+RENDERER_NAMESPACE_END
@@ -0,0 +1,106 @@
+#include "Splat/SplatColorCache.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+RENDERER_NAMESPACE_BEGIN
+
+namespace
+{
+const size_t CHUNK_GRAIN_SIZE = 8;
+
+// 点到轴对齐包围盒的距离（在盒内为 0）
+float DistanceToBox(const float *point, const float *boxMin, const float *boxMax)
+{
+    float distSq = 0.0f;
+    for (int c = 0; c < 3; ++c)
+    {
+        const float d = std::max(std::max(boxMin[c] - point[c], point[c] - boxMax[c]), 0.0f);
+        distSq += d * d;
+    }
+    return std::sqrt(distSq);
+}
+} // namespace
+
+SplatColorCache::SplatColorCache(ThreadPool &pool) : m_pool(pool)
+{
+}
+
+void SplatColorCache::Invalidate()
+{
+    std::fill(m_chunkValid.begin(), m_chunkValid.end(), 0);
+}
+
+size_t SplatColorCache::Update(const GaussianCloud &cloud, const SplatChunkSet &chunks, const float *cameraPosition,
+                               const uint8_t *chunkActive)
+{
+    const auto start = std::chrono::steady_clock::now();
+    m_stats = Stats();
+
+    const std::vector<SplatChunk> &chunkList = chunks.GetChunks();
+    const size_t chunkCount = chunkList.size();
+    if (cloud.GetStorage() != m_storage || cloud.GetCount() != m_count || m_chunkValid.size() != chunkCount)
+    {
+        m_storage = cloud.GetStorage();
+        m_count = cloud.GetCount();
+        m_colors.assign(m_count * 3, 0.0f);
+        m_chunkCameras.assign(chunkCount * 3, 0.0f);
+        m_chunkValid.assign(chunkCount, 0);
+    }
+    if (chunks.GetSplatCount() != m_count)
+        return 0;
+
+    m_evaluator.SetCamera(cameraPosition);
+    const SHColorSource source = SHEvaluator::MakeSource(cloud);
+    float *rgb[3] = {m_colors.data(), m_colors.data() + m_count, m_colors.data() + 2 * m_count};
+    const uint32_t *indices = chunks.GetIndices().data();
+    const bool contiguous = chunks.IsContiguous();
+    // asin(d / r) < θ  <=>  d < r · sin θ（θ < 90°）
+    const float sinThreshold = std::sin(std::min(m_angleThreshold, 1.5707963f));
+
+    std::vector<size_t> evaluated(chunkCount, 0);
+    m_pool.ParallelFor(0, chunkCount, CHUNK_GRAIN_SIZE, [&](size_t begin, size_t end, unsigned int) {
+        for (size_t c = begin; c < end; ++c)
+        {
+            if (chunkActive && !chunkActive[c])
+                continue;
+            const SplatChunk &chunk = chunkList[c];
+            float *lastCamera = &m_chunkCameras[c * 3];
+            if (m_chunkValid[c] && m_angleThreshold > 0.0f)
+            {
+                const float dx = cameraPosition[0] - lastCamera[0];
+                const float dy = cameraPosition[1] - lastCamera[1];
+                const float dz = cameraPosition[2] - lastCamera[2];
+                const float moved = std::sqrt(dx * dx + dy * dy + dz * dz);
+                if (moved < DistanceToBox(lastCamera, chunk.boundsMin, chunk.boundsMax) * sinThreshold)
+                    continue;
+            }
+
+            if (contiguous)
+                m_evaluator.Evaluate(source, source.shDegree, chunk.begin, chunk.begin + chunk.count, rgb);
+            else
+                m_evaluator.EvaluateIndexed(source, source.shDegree, indices + chunk.begin, chunk.count, rgb);
+            for (int k = 0; k < 3; ++k)
+                lastCamera[k] = cameraPosition[k];
+            m_chunkValid[c] = 1;
+            evaluated[c] = chunk.count;
+        }
+    });
+
+    for (size_t c = 0; c < chunkCount; ++c)
+    {
+        if (evaluated[c] > 0)
+        {
+            ++m_stats.chunksEvaluated;
+            m_stats.splatsEvaluated += evaluated[c];
+        }
+        else if (!chunkActive || chunkActive[c])
+        {
+            ++m_stats.chunksReused;
+        }
+    }
+    m_stats.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return m_stats.splatsEvaluated;
+}
+
+RENDERER_NAMESPACE_END
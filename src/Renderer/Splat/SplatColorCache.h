@@ -0,0 +1,80 @@
+#pragma once
+
+#include "Core/RenderCore.h"
+#include "Core/ThreadPool.h"
+#include "Splat/GaussianCloud.h"
+#include "Splat/SHEvaluator.h"
+#include "Splat/SplatChunkSet.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+RENDERER_NAMESPACE_BEGIN
+
+/// 逐高斯 RGB 缓存：按 SplatChunkSet 的块为单位重新求值球谐颜色
+///
+/// 每块记录上次求值时的相机位置。相机移动 d 后，块内任一点视线方向的变化不超过 asin(d / r)，
+/// r 为上次相机到块包围盒（外扩 maxExtent 前的中心包围盒）的距离；该上界小于阈值角的块沿用缓存。
+/// 相机只旋转不平移时视线方向不变，全部命中缓存。阈值为 0 时每次都重新求值。
+class RENDERER_API SplatColorCache
+{
+public:
+    struct Stats
+    {
+        size_t chunksEvaluated = 0;
+        size_t chunksReused = 0;
+        size_t splatsEvaluated = 0;
+        double milliseconds = 0.0;
+    };
+
+    explicit SplatColorCache(ThreadPool &pool = ThreadPool::Global());
+
+    SplatColorCache(const SplatColorCache &) = delete;
+    SplatColorCache &operator=(const SplatColorCache &) = delete;
+
+    /// 允许沿用缓存的最大视线方向变化（弧度）
+    void SetAngleThreshold(float radians)
+    {
+        m_angleThreshold = radians;
+    }
+    float GetAngleThreshold() const
+    {
+        return m_angleThreshold;
+    }
+    void SetSIMDLevel(CpuFeatures::SIMDLevel level)
+    {
+        m_evaluator.SetSIMDLevel(level);
+    }
+
+    /// 清空缓存，下次 Update 全部重新求值
+    void Invalidate();
+
+    /// 更新颜色，返回重新求值的高斯数
+    /// @param chunkActive 可选，长度为块数；为 0 的块本次跳过（如不含可见高斯），其缓存状态保持不变
+    size_t Update(const GaussianCloud &cloud, const SplatChunkSet &chunks, const float *cameraPosition,
+                  const uint8_t *chunkActive = nullptr);
+
+    /// 颜色平面（按原始高斯下标），长度为点云高斯数
+    const float *GetColor(int channel) const
+    {
+        return m_colors.data() + static_cast<size_t>(channel) * m_count;
+    }
+    const Stats &GetStats() const
+    {
+        return m_stats;
+    }
+
+private:
+    ThreadPool &m_pool;
+    SHEvaluator m_evaluator;
+    float m_angleThreshold = 0.0175f; // 约 1°
+
+    const unsigned char *m_storage = nullptr; // 缓存对应的点云存储，变化时整体失效
+    size_t m_count = 0;
+    std::vector<float> m_colors;        // 3 个平面
+    std::vector<float> m_chunkCameras;  // 每块上次求值时的相机位置
+    std::vector<uint8_t> m_chunkValid;
+    Stats m_stats;
+};
+
+RENDERER_NAMESPACE_END
@@ -0,0 +1,264 @@
+#include "Splat/SplatCuller.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+
+RENDERER_NAMESPACE_BEGIN
+
+namespace
+{
+const size_t CULL_GRAIN_SIZE = 65536;
+const size_t CHUNK_GRAIN_SIZE = 16;
+
+// 每个高斯的判定结果
+enum CullReason : uint8_t
+{
+    CULL_VISIBLE = 0,
+    CULL_FRUSTUM,
+    CULL_OPACITY,
+    CULL_SIZE,
+    CULL_REASON_COUNT
+};
+
+// 块相对视锥的位置
+enum ChunkState : uint8_t
+{
+    CHUNK_OUTSIDE = 0,
+    CHUNK_INSIDE,
+    CHUNK_PARTIAL
+};
+
+// 逐高斯判定：视图参数与属性平面指针
+struct SplatTester
+{
+    const float *position[3];
+    const float *scale[3];
+    const float *opacity;
+    const float *v; // 视图矩阵，列主序：第 r 行为 v[r], v[4 + r], v[8 + r], v[12 + r]
+    float limX, limY;
+    float sphereScaleX, sphereScaleY;
+    float minOpacity, minRadius, nearClip;
+    float focal;
+    float jacobianLimX, jacobianLimY;
+
+    SplatTester(const GaussianCloud &cloud, const float *view, const SplatCullParams &params, float focalMax,
+                float tanHalfFovX, float tanHalfFovY)
+    {
+        for (int c = 0; c < 3; ++c)
+        {
+            position[c] = cloud.GetComponent(GaussianCloud::Attribute::Position, c);
+            scale[c] = cloud.GetComponent(GaussianCloud::Attribute::Scale, c);
+        }
+        opacity = cloud.GetComponent(GaussianCloud::Attribute::Opacity, 0);
+        v = view;
+        limX = params.guardBand * tanHalfFovX;
+        limY = params.guardBand * tanHalfFovY;
+        // 侧平面 |t.x| = lim · z 的法向未归一化，球半径需乘以 sqrt(1 + lim²)
+        sphereScaleX = std::sqrt(1.0f + limX * limX);
+        sphereScaleY = std::sqrt(1.0f + limY * limY);
+        minOpacity = params.minOpacity;
+        minRadius = params.minRadius;
+        nearClip = params.nearClip;
+        focal = focalMax;
+        // 与 CovarianceProjector 相同的 Jacobian 截断范围
+        jacobianLimX = 1.3f * tanHalfFovX;
+        jacobianLimY = 1.3f * tanHalfFovY;
+    }
+
+    // TestFrustum 为 false 时调用方已确认高斯在视锥内
+    template <bool TestFrustum> uint8_t Classify(size_t i) const
+    {
+        const float px = position[0][i], py = position[1][i], pz = position[2][i];
+        const float tx = v[0] * px + v[4] * py + v[8] * pz + v[12];
+        const float ty = v[1] * px + v[5] * py + v[9] * pz + v[13];
+        const float z = -(v[2] * px + v[6] * py + v[10] * pz + v[14]);
+        const float extent = 3.0f * std::max(scale[0][i], std::max(scale[1][i], scale[2][i]));
+
+        if (opacity[i] < minOpacity)
+            return CULL_OPACITY;
+        if (TestFrustum && (!(z > nearClip) || std::fabs(tx) > limX * z + extent * sphereScaleX ||
+                            std::fabs(ty) > limY * z + extent * sphereScaleY))
+            return CULL_FRUSTUM;
+        if (minRadius > 0.0f)
+        {
+            const float invZ = 1.0f / z;
+            const float u = std::min(std::fabs(tx) * invZ, jacobianLimX);
+            const float w = std::min(std::fabs(ty) * invZ, jacobianLimY);
+            if (extent * focal * invZ * std::sqrt(1.0f + u * u + w * w) < minRadius)
+                return CULL_SIZE;
+        }
+        return CULL_VISIBLE;
+    }
+
+    // 与 Classify 的视锥判定保持一致：OUTSIDE 时块内每个高斯都会被判为 CULL_FRUSTUM，
+    // INSIDE 时块内每个高斯都通过视锥判定
+    uint8_t ClassifyChunk(const SplatChunk &chunk) const
+    {
+        float center[3];
+        float half[3];
+        for (int c = 0; c < 3; ++c)
+        {
+            center[c] = 0.5f * (chunk.boundsMin[c] + chunk.boundsMax[c]);
+            half[c] = 0.5f * (chunk.boundsMax[c] - chunk.boundsMin[c]);
+        }
+        // 中心包围盒变换到视图空间后的轴对齐包围盒
+        const float tx = v[0] * center[0] + v[4] * center[1] + v[8] * center[2] + v[12];
+        const float ty = v[1] * center[0] + v[5] * center[1] + v[9] * center[2] + v[13];
+        const float z = -(v[2] * center[0] + v[6] * center[1] + v[10] * center[2] + v[14]);
+        const float hx = std::fabs(v[0]) * half[0] + std::fabs(v[4]) * half[1] + std::fabs(v[8]) * half[2];
+        const float hy = std::fabs(v[1]) * half[0] + std::fabs(v[5]) * half[1] + std::fabs(v[9]) * half[2];
+        const float hz = std::fabs(v[2]) * half[0] + std::fabs(v[6]) * half[1] + std::fabs(v[10]) * half[2];
+
+        // 近平面只看中心；侧平面 ±t - lim · z 在包围盒上的最小值超过最大球半径即整块在外
+        if (z + hz <= nearClip)
+            return CHUNK_OUTSIDE;
+        const float marginX = hx + limX * hz;
+        const float marginY = hy + limY * hz;
+        const float reachX = chunk.maxExtent * sphereScaleX;
+        const float reachY = chunk.maxExtent * sphereScaleY;
+        const float planeX = std::fabs(tx) - limX * z;
+        const float planeY = std::fabs(ty) - limY * z;
+        if (planeX - marginX > reachX || planeY - marginY > reachY)
+            return CHUNK_OUTSIDE;
+        if (z - hz > nearClip && planeX + marginX <= 0.0f && planeY + marginY <= 0.0f)
+            return CHUNK_INSIDE;
+        return CHUNK_PARTIAL;
+    }
+};
+} // namespace
+
+SplatCuller::SplatCuller(ThreadPool &pool) : m_pool(pool)
+{
+}
+
+void SplatCuller::SetView(const float *viewMatrix, float focalX, float focalY, float tanHalfFovX, float tanHalfFovY)
+{
+    std::memcpy(m_view, viewMatrix, sizeof(m_view));
+    m_focal = std::max(focalX, focalY);
+    m_tanHalfFovX = tanHalfFovX;
+    m_tanHalfFovY = tanHalfFovY;
+}
+
+size_t SplatCuller::Cull(const GaussianCloud &cloud, const SplatChunkSet *chunks)
+{
+    if (chunks && !chunks->IsEmpty() && chunks->GetSplatCount() == cloud.GetCount())
+        return CullChunks(cloud, *chunks);
+
+    const auto start = std::chrono::steady_clock::now();
+    const size_t count = cloud.GetCount();
+    m_flags.resize(count);
+    m_stats = Stats();
+
+    const SplatTester tester(cloud, m_view, m_params, m_focal, m_tanHalfFovX, m_tanHalfFovY);
+    std::vector<size_t> reasonCounts(static_cast<size_t>(m_pool.GetThreadCount()) * CULL_REASON_COUNT, 0);
+    m_pool.ParallelFor(0, count, CULL_GRAIN_SIZE, [&](size_t begin, size_t end, unsigned int worker) {
+        size_t *counts = &reasonCounts[static_cast<size_t>(worker) * CULL_REASON_COUNT];
+        for (size_t i = begin; i < end; ++i)
+        {
+            const uint8_t reason = tester.Classify<true>(i);
+            m_flags[i] = reason;
+            ++counts[reason];
+        }
+    });
+
+    m_visible.resize(count);
+    const size_t visible =
+        m_pool.ParallelCompact(count, CULL_GRAIN_SIZE, [&](size_t i) { return m_flags[i] == CULL_VISIBLE; },
+                               [&](size_t i, size_t k) { m_visible[k] = static_cast<uint32_t>(i); });
+    m_visible.resize(visible);
+
+    for (size_t worker = 0; worker < m_pool.GetThreadCount(); ++worker)
+    {
+        const size_t *counts = &reasonCounts[worker * CULL_REASON_COUNT];
+        m_stats.frustumCulled += counts[CULL_FRUSTUM];
+        m_stats.opacityCulled += counts[CULL_OPACITY];
+        m_stats.sizeCulled += counts[CULL_SIZE];
+    }
+    m_stats.visibleCount = visible;
+    m_stats.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return visible;
+}
+
+size_t SplatCuller::CullChunks(const GaussianCloud &cloud, const SplatChunkSet &chunks)
+{
+    const auto start = std::chrono::steady_clock::now();
+    const std::vector<SplatChunk> &chunkList = chunks.GetChunks();
+    const uint32_t *indices = chunks.GetIndices().data();
+    const size_t chunkCount = chunkList.size();
+    m_flags.resize(cloud.GetCount());
+    m_stats = Stats();
+
+    const SplatTester tester(cloud, m_view, m_params, m_focal, m_tanHalfFovX, m_tanHalfFovY);
+    std::vector<uint8_t> chunkStates(chunkCount);
+    std::vector<size_t> chunkOffsets(chunkCount, 0);
+    std::vector<size_t> reasonCounts(static_cast<size_t>(m_pool.GetThreadCount()) * CULL_REASON_COUNT, 0);
+
+    // 第一遍：块判定 + 块内逐高斯判定并计数，m_flags 按块内顺序（与 indices 对齐）存放
+    m_pool.ParallelFor(0, chunkCount, CHUNK_GRAIN_SIZE, [&](size_t begin, size_t end, unsigned int worker) {
+        size_t *counts = &reasonCounts[static_cast<size_t>(worker) * CULL_REASON_COUNT];
+        for (size_t c = begin; c < end; ++c)
+        {
+            const SplatChunk &chunk = chunkList[c];
+            const uint8_t state = tester.ClassifyChunk(chunk);
+            chunkStates[c] = state;
+            if (state == CHUNK_OUTSIDE)
+            {
+                counts[CULL_FRUSTUM] += chunk.count;
+                continue;
+            }
+
+            size_t kept = 0;
+            for (size_t k = chunk.begin; k < chunk.begin + chunk.count; ++k)
+            {
+                const uint8_t reason =
+                    state == CHUNK_INSIDE ? tester.Classify<false>(indices[k]) : tester.Classify<true>(indices[k]);
+                m_flags[k] = reason;
+                ++counts[reason];
+                kept += reason == CULL_VISIBLE ? 1 : 0;
+            }
+            chunkOffsets[c] = kept;
+        }
+    });
+
+    size_t visible = 0;
+    for (size_t c = 0; c < chunkCount; ++c)
+    {
+        const size_t kept = chunkOffsets[c];
+        chunkOffsets[c] = visible;
+        visible += kept;
+        m_stats.chunksCulled += chunkStates[c] == CHUNK_OUTSIDE ? 1 : 0;
+        m_stats.chunksInside += chunkStates[c] == CHUNK_INSIDE ? 1 : 0;
+    }
+    m_stats.chunksPartial = chunkCount - m_stats.chunksCulled - m_stats.chunksInside;
+
+    // 第二遍：按块的前缀和写出可见下标
+    m_visible.resize(visible);
+    m_pool.ParallelFor(0, chunkCount, CHUNK_GRAIN_SIZE, [&](size_t begin, size_t end, unsigned int) {
+        for (size_t c = begin; c < end; ++c)
+        {
+            if (chunkStates[c] == CHUNK_OUTSIDE)
+                continue;
+            const SplatChunk &chunk = chunkList[c];
+            size_t cursor = chunkOffsets[c];
+            for (size_t k = chunk.begin; k < chunk.begin + chunk.count; ++k)
+            {
+                if (m_flags[k] == CULL_VISIBLE)
+                    m_visible[cursor++] = indices[k];
+            }
+        }
+    });
+
+    for (size_t worker = 0; worker < m_pool.GetThreadCount(); ++worker)
+    {
+        const size_t *counts = &reasonCounts[worker * CULL_REASON_COUNT];
+        m_stats.frustumCulled += counts[CULL_FRUSTUM];
+        m_stats.opacityCulled += counts[CULL_OPACITY];
+        m_stats.sizeCulled += counts[CULL_SIZE];
+    }
+    m_stats.visibleCount = visible;
+    m_stats.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return visible;
+}
+
+RENDERER_NAMESPACE_END
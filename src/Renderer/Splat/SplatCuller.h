@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Core/RenderCore.h"
+#include "Core/ThreadPool.h"
+#include "Splat/GaussianCloud.h"
+#include "Splat/SplatChunkSet.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+RENDERER_NAMESPACE_BEGIN
+
+/// 剔除阈值
+struct SplatCullParams
+{
+    float guardBand = 1.3f;            // 视锥在 x/y 方向放宽的倍数（作用于半视场角正切），与投影的 Jacobian 限制一致
+    float minOpacity = 1.0f / 255.0f;  // 不透明度低于该值的高斯对任何像素的 α 都不足 1/255
+    float minRadius = 0.3f;            // 3σ 屏幕半径（未加低通，像素）的上界低于该值时剔除，0 表示不按大小剔除
+    float nearClip = 0.01f;
+};
+
+/// 排序前的逐高斯剔除：视锥（带保护带）、不透明度、亚像素大小，并行流压缩出可见下标列表
+///
+/// 判定只使用位置、最大缩放与不透明度，不做协方差投影：
+///   - 视锥：中心在放宽后的视锥外，且 3σ 球包围（3 · 最大缩放）也不与之相交
+///   - 大小：3 · 最大缩放 · 焦距 / 深度 · sqrt(1 + u² + v²)（u, v 为截断后的视线斜率）是投影 3σ 半径的上界
+/// 因此只会剔除确实不可见或小于阈值的高斯，排序器与上传只需处理可见部分。
+///
+/// 传入 SplatChunkSet 时先按块判定：块包围盒（外扩 maxExtent）完全在视锥外则整块跳过，
+/// 完全在视锥内则块内高斯只做不透明度与大小判定，只有跨越视锥边界的块逐个做视锥判定。
+class RENDERER_API SplatCuller
+{
+public:
+    /// 最近一次剔除的统计
+    struct Stats
+    {
+        size_t visibleCount = 0;
+        size_t frustumCulled = 0;
+        size_t opacityCulled = 0;
+        size_t sizeCulled = 0;
+        size_t chunksCulled = 0;  // 整块剔除的块数（其中的高斯计入 frustumCulled）
+        size_t chunksInside = 0;  // 整块在视锥内的块数
+        size_t chunksPartial = 0; // 跨越视锥边界、逐高斯判定的块数
+        double milliseconds = 0.0;
+    };
+
+    explicit SplatCuller(ThreadPool &pool = ThreadPool::Global());
+
+    SplatCuller(const SplatCuller &) = delete;
+    SplatCuller &operator=(const SplatCuller &) = delete;
+
+    void SetParams(const SplatCullParams &params)
+    {
+        m_params = params;
+    }
+    const SplatCullParams &GetParams() const
+    {
+        return m_params;
+    }
+
+    /// 参数含义同 CovarianceProjector::SetView
+    void SetView(const float *viewMatrix, float focalX, float focalY, float tanHalfFovX, float tanHalfFovY);
+
+    /// 剔除整个点云，返回可见高斯数
+    /// chunks 为空指针、为空或与点云高斯数不一致时退化为逐高斯判定
+    size_t Cull(const GaussianCloud &cloud, const SplatChunkSet *chunks = nullptr);
+
+    /// 可见高斯的原始下标，长度为 GetVisibleCount()
+    /// 逐高斯判定时按下标升序，分块判定时按块的顺序
+    const std::vector<uint32_t> &GetVisibleIndices() const
+    {
+        return m_visible;
+    }
+    size_t GetVisibleCount() const
+    {
+        return m_visible.size();
+    }
+    const Stats &GetStats() const
+    {
+        return m_stats;
+    }
+
+private:
+    size_t CullChunks(const GaussianCloud &cloud, const SplatChunkSet &chunks);
+
+    ThreadPool &m_pool;
+    SplatCullParams m_params;
+    float m_view[16] = {};
+    float m_focal = 0.0f; // max(focalX, focalY)
+    float m_tanHalfFovX = 1.0f;
+    float m_tanHalfFovY = 1.0f;
+
+    std::vector<uint8_t> m_flags; // 每个高斯的判定结果（CullReason），分块判定时按块内顺序存放
+    std::vector<uint32_t> m_visible;
+    Stats m_stats;
+};
+
+RENDERER_NAMESPACE_END
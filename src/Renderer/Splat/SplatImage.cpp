@@ -0,0 +1,129 @@
+#include "Splat/SplatImage.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+RENDERER_NAMESPACE_BEGIN
+
+namespace
+{
+// ---- .spim 文件格式 ----
+const char SPIM_MAGIC[4] = {'S', 'P', 'I', 'M'};
+const uint32_t SPIM_VERSION = 1;
+// 单边尺寸上限，防止损坏的头部导致巨量分配
+const int SPIM_MAX_SIZE = 16384;
+
+struct SpimHeader
+{
+    char magic[4];
+    uint32_t version;
+    int32_t width;
+    int32_t height;
+    float viewMatrix[16];
+    float projMatrix[16];
+};
+static_assert(sizeof(SpimHeader) % 4 == 0, "SpimHeader must stay 4-byte packed");
+} // namespace
+
+bool SplatImage::Save(const std::string &filename) const
+{
+    if (width <= 0 || height <= 0 || pixels.size() != static_cast<size_t>(width) * height * 4)
+        return false;
+
+    SpimHeader header = {};
+    std::memcpy(header.magic, SPIM_MAGIC, sizeof(SPIM_MAGIC));
+    header.version = SPIM_VERSION;
+    header.width = width;
+    header.height = height;
+    std::copy(viewMatrix, viewMatrix + 16, header.viewMatrix);
+    std::copy(projMatrix, projMatrix + 16, header.projMatrix);
+
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    if (!out)
+        return false;
+    out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+    out.write(reinterpret_cast<const char *>(pixels.data()),
+              static_cast<std::streamsize>(pixels.size() * sizeof(float)));
+    return static_cast<bool>(out);
+}
+
+bool SplatImage::Load(const std::string &filename)
+{
+    std::ifstream in(filename, std::ios::binary);
+    if (!in)
+        return false;
+
+    SpimHeader header;
+    if (!in.read(reinterpret_cast<char *>(&header), sizeof(header)) ||
+        std::memcmp(header.magic, SPIM_MAGIC, sizeof(SPIM_MAGIC)) != 0 || header.version != SPIM_VERSION ||
+        header.width <= 0 || header.height <= 0 || header.width > SPIM_MAX_SIZE || header.height > SPIM_MAX_SIZE)
+        return false;
+
+    std::vector<float> data(static_cast<size_t>(header.width) * header.height * 4);
+    if (!in.read(reinterpret_cast<char *>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(float))))
+        return false;
+
+    width = header.width;
+    height = header.height;
+    std::copy(header.viewMatrix, header.viewMatrix + 16, viewMatrix);
+    std::copy(header.projMatrix, header.projMatrix + 16, projMatrix);
+    pixels.swap(data);
+    return true;
+}
+
+bool SplatImage::SavePFM(const std::string &filename) const
+{
+    if (width <= 0 || height <= 0 || pixels.size() != static_cast<size_t>(width) * height * 4)
+        return false;
+
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    if (!out)
+        return false;
+    // 比例因子为负表示小端；PFM 行序本身即从下往上，与像素存放顺序一致
+    out << "PF\n" << width << " " << height << "\n-1.0\n";
+    std::vector<float> row(static_cast<size_t>(width) * 3);
+    for (int y = 0; y < height; ++y)
+    {
+        const float *src = &pixels[static_cast<size_t>(y) * width * 4];
+        for (int x = 0; x < width; ++x)
+        {
+            for (int c = 0; c < 3; ++c)
+                row[x * 3 + c] = src[x * 4 + c];
+        }
+        out.write(reinterpret_cast<const char *>(row.data()), static_cast<std::streamsize>(row.size() * sizeof(float)));
+    }
+    return static_cast<bool>(out);
+}
+
+bool SplatImage::Compare(const SplatImage &a, const SplatImage &b, float threshold, Difference &difference)
+{
+    difference = Difference();
+    if (a.width != b.width || a.height != b.height || a.pixels.size() != b.pixels.size() || a.pixels.empty())
+        return false;
+
+    double sumSquared = 0.0;
+    const size_t pixelCount = a.pixels.size() / 4;
+    for (size_t p = 0; p < pixelCount; ++p)
+    {
+        float pixelError = 0.0f;
+        for (int c = 0; c < 4; ++c)
+        {
+            const float error = std::fabs(a.pixels[p * 4 + c] - b.pixels[p * 4 + c]);
+            sumSquared += static_cast<double>(error) * error;
+            pixelError = std::max(pixelError, error);
+        }
+        difference.maxError = std::max(difference.maxError, pixelError);
+        if (pixelError > threshold)
+            ++difference.differingPixels;
+    }
+
+    difference.rmse = std::sqrt(sumSquared / static_cast<double>(a.pixels.size()));
+    difference.psnr = difference.rmse > 0.0 ? -20.0 * std::log10(difference.rmse)
+                                            : std::numeric_limits<double>::infinity();
+    return true;
+}
+
+RENDERER_NAMESPACE_END
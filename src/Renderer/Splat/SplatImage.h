@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Core/RenderCore.h"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+RENDERER_NAMESPACE_BEGIN
+
+/// 带渲染视图的 RGBA float 图像，用于对比 SplatRasterizer 与 SplatPass（GL 读回）渲染同一视图的结果
+///
+/// 像素约定与 SplatRasterizer::GetImage 一致：RGB 为预乘颜色（未叠加背景），A = 1 - T，行从下往上存放。
+/// .spim 文件：[SpimHeader：宽高 + 列主序视图 / 投影矩阵][width * height * 4 个 float]，小端，
+/// 读入后可直接把矩阵交给 SplatRasterizer::Render 重现同一视图。
+struct RENDERER_API SplatImage
+{
+    /// 两幅图像的逐通道差异
+    struct Difference
+    {
+        double rmse = 0.0;          // 全部通道的均方根误差
+        double psnr = 0.0;          // 以 1.0 为峰值的 PSNR（dB），完全相同时为无穷大
+        float maxError = 0.0f;      // 单通道最大绝对误差
+        size_t differingPixels = 0; // 任一通道误差超过阈值的像素数
+    };
+
+    int width = 0;
+    int height = 0;
+    float viewMatrix[16] = {};
+    float projMatrix[16] = {};
+    std::vector<float> pixels; // width * height * 4
+
+    /// 写入 .spim 文件，失败返回 false
+    bool Save(const std::string &filename) const;
+    /// 读取 .spim 文件，格式不符或数据不完整时返回 false
+    bool Load(const std::string &filename);
+    /// 以 PFM（RGB，行从下往上）写出预乘颜色，即叠加黑色背景的结果，便于用常见看图工具查看
+    bool SavePFM(const std::string &filename) const;
+
+    /// 比较两幅同尺寸图像，尺寸不同时返回 false
+    /// @param threshold 单通道误差超过该值的像素计入 differingPixels
+    static bool Compare(const SplatImage &a, const SplatImage &b, float threshold, Difference &difference);
+};
+
+RENDERER_NAMESPACE_END
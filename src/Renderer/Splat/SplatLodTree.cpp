@@ -0,0 +1,459 @@
+#include "Splat/SplatLodTree.h"
+#include "Splat/RadixSort.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+RENDERER_NAMESPACE_BEGIN
+
+namespace
+{
+// 构建时每个任务合并的父节点数
+const size_t MERGE_GRAIN_SIZE = 256;
+// 选择时先串行广度展开到约这么多节点，再把每个节点的子树分给线程深度遍历
+const size_t SELECT_FRONTIER_SIZE = 1024;
+const size_t SELECT_GRAIN_SIZE = 16;
+const int JACOBI_MAX_SWEEPS = 16;
+
+enum NodeAction : uint8_t
+{
+    NODE_CULL = 0,
+    NODE_EMIT,
+    NODE_REFINE,
+};
+
+// 对称 3x3 矩阵的 Jacobi 特征分解：a 输入矩阵（会被破坏），输出特征值 eigenvalues 与特征向量列 vectors
+void EigenSymmetric3(double a[3][3], double eigenvalues[3], double vectors[3][3])
+{
+    for (int r = 0; r < 3; ++r)
+        for (int c = 0; c < 3; ++c)
+            vectors[r][c] = r == c ? 1.0 : 0.0;
+
+    for (int sweep = 0; sweep < JACOBI_MAX_SWEEPS; ++sweep)
+    {
+        const double offDiagonal = a[0][1] * a[0][1] + a[0][2] * a[0][2] + a[1][2] * a[1][2];
+        const double diagonal = a[0][0] * a[0][0] + a[1][1] * a[1][1] + a[2][2] * a[2][2];
+        if (offDiagonal <= 1e-24 * diagonal || offDiagonal == 0.0)
+            break;
+
+        for (int p = 0; p < 2; ++p)
+        {
+            for (int q = p + 1; q < 3; ++q)
+            {
+                if (a[p][q] == 0.0)
+                    continue;
+                // 旋转角使 a[p][q] 归零
+                const double theta = (a[q][q] - a[p][p]) / (2.0 * a[p][q]);
+                const double t = (theta >= 0.0 ? 1.0 : -1.0) / (std::fabs(theta) + std::sqrt(theta * theta + 1.0));
+                const double c = 1.0 / std::sqrt(t * t + 1.0);
+                const double s = t * c;
+                for (int k = 0; k < 3; ++k)
+                {
+                    const double akp = a[k][p], akq = a[k][q];
+                    a[k][p] = c * akp - s * akq;
+                    a[k][q] = s * akp + c * akq;
+                }
+                for (int k = 0; k < 3; ++k)
+                {
+                    const double apk = a[p][k], aqk = a[q][k];
+                    a[p][k] = c * apk - s * aqk;
+                    a[q][k] = s * apk + c * aqk;
+                }
+                for (int k = 0; k < 3; ++k)
+                {
+                    const double vkp = vectors[k][p], vkq = vectors[k][q];
+                    vectors[k][p] = c * vkp - s * vkq;
+                    vectors[k][q] = s * vkp + c * vkq;
+                }
+            }
+        }
+    }
+    for (int k = 0; k < 3; ++k)
+        eigenvalues[k] = a[k][k];
+}
+
+// 旋转矩阵转四元数 (x, y, z, w)，与 CovarianceUtils 中四元数转矩阵互逆
+void MatrixToQuaternion(const double m[3][3], float *q)
+{
+    const double trace = m[0][0] + m[1][1] + m[2][2];
+    double x, y, z, w;
+    if (trace > 0.0)
+    {
+        const double s = 0.5 / std::sqrt(trace + 1.0);
+        w = 0.25 / s;
+        x = (m[2][1] - m[1][2]) * s;
+        y = (m[0][2] - m[2][0]) * s;
+        z = (m[1][0] - m[0][1]) * s;
+    }
+    else if (m[0][0] > m[1][1] && m[0][0] > m[2][2])
+    {
+        const double s = 2.0 * std::sqrt(1.0 + m[0][0] - m[1][1] - m[2][2]);
+        w = (m[2][1] - m[1][2]) / s;
+        x = 0.25 * s;
+        y = (m[0][1] + m[1][0]) / s;
+        z = (m[0][2] + m[2][0]) / s;
+    }
+    else if (m[1][1] > m[2][2])
+    {
+        const double s = 2.0 * std::sqrt(1.0 + m[1][1] - m[0][0] - m[2][2]);
+        w = (m[0][2] - m[2][0]) / s;
+        x = (m[0][1] + m[1][0]) / s;
+        y = 0.25 * s;
+        z = (m[1][2] + m[2][1]) / s;
+    }
+    else
+    {
+        const double s = 2.0 * std::sqrt(1.0 + m[2][2] - m[0][0] - m[1][1]);
+        w = (m[1][0] - m[0][1]) / s;
+        x = (m[0][2] + m[2][0]) / s;
+        y = (m[1][2] + m[2][1]) / s;
+        z = 0.25 * s;
+    }
+    const double invLength = 1.0 / std::sqrt(x * x + y * y + z * z + w * w);
+    q[0] = static_cast<float>(x * invLength);
+    q[1] = static_cast<float>(y * invLength);
+    q[2] = static_cast<float>(z * invLength);
+    q[3] = static_cast<float>(w * invLength);
+}
+} // namespace
+
+SplatLodTree::SplatLodTree(ThreadPool &pool) : m_pool(pool)
+{
+}
+
+void SplatLodTree::Clear()
+{
+    m_cloud.reset();
+    m_nodes.clear();
+    m_childIndices.clear();
+    m_positions.clear();
+    m_positions.shrink_to_fit();
+    m_leafCount = 0;
+    m_selection.clear();
+}
+
+void SplatLodTree::Build(const GaussianCloud &cloud, int branching)
+{
+    Clear();
+    const size_t leafCount = cloud.GetCount();
+    if (leafCount == 0)
+        return;
+    const size_t fanOut = static_cast<size_t>(std::max(2, branching));
+
+    // 内部节点数：逐层按 fanOut 向上取整，直到只剩一个节点
+    size_t internalCount = 0;
+    for (size_t levelCount = leafCount; levelCount > 1; levelCount = (levelCount + fanOut - 1) / fanOut)
+        internalCount += (levelCount + fanOut - 1) / fanOut;
+    const size_t nodeCount = leafCount + internalCount;
+
+    // 节点点云只保存内部节点（叶子仍在原点云中，不复制）；位置平面按全部节点合成一份，供选择与排序使用
+    const int shDegree = cloud.GetSHDegree();
+    m_cloud = std::make_shared<GaussianCloud>();
+    m_cloud->Allocate(internalCount, shDegree);
+    m_cloud->SetBounds(cloud.GetBoundsMin(), cloud.GetBoundsMax());
+    m_positions.resize(nodeCount * 3);
+    float *position[3];
+    for (int c = 0; c < 3; ++c)
+    {
+        position[c] = m_positions.data() + static_cast<size_t>(c) * nodeCount;
+        std::memcpy(position[c], cloud.GetComponent(GaussianCloud::Attribute::Position, c), leafCount * sizeof(float));
+    }
+
+    m_nodes.assign(nodeCount, SplatLodNode());
+    m_childIndices.reserve(nodeCount - 1);
+    m_leafCount = leafCount;
+
+    GaussianCloud &tree = *m_cloud;
+    float *scale[3], *rotation[4], *cov[6], *shDC[3];
+    for (int c = 0; c < 3; ++c)
+    {
+        scale[c] = tree.GetComponent(GaussianCloud::Attribute::Scale, c);
+        shDC[c] = tree.GetComponent(GaussianCloud::Attribute::SHDC, c);
+    }
+    for (int c = 0; c < 4; ++c)
+        rotation[c] = tree.GetComponent(GaussianCloud::Attribute::Rotation, c);
+    for (int c = 0; c < 6; ++c)
+        cov[c] = tree.GetComponent(GaussianCloud::Attribute::Covariance, c);
+    float *opacity = tree.GetComponent(GaussianCloud::Attribute::Opacity, 0);
+    float *shRest = tree.GetAttribute(GaussianCloud::Attribute::SHRest);
+    const int restComponents = GaussianCloud::GetComponentCount(GaussianCloud::Attribute::SHRest, shDegree);
+
+    const float *leafScale[3] = {cloud.GetComponent(GaussianCloud::Attribute::Scale, 0),
+                                 cloud.GetComponent(GaussianCloud::Attribute::Scale, 1),
+                                 cloud.GetComponent(GaussianCloud::Attribute::Scale, 2)};
+    const float *leafOpacity = cloud.GetComponent(GaussianCloud::Attribute::Opacity, 0);
+    for (size_t i = 0; i < leafCount; ++i)
+    {
+        SplatLodNode &node = m_nodes[i];
+        node.extent = 3.0f * std::max(leafScale[0][i], std::max(leafScale[1][i], leafScale[2][i]));
+        node.radius = node.extent;
+        node.opacity = leafOpacity[i];
+    }
+
+    // 第 0 层：叶子的 Morton 序，相邻节点空间上相邻，按组合并即得到紧凑的父节点
+    std::vector<uint32_t> level(leafCount);
+    for (size_t i = 0; i < leafCount; ++i)
+        level[i] = static_cast<uint32_t>(i);
+    if (!cloud.IsMortonOrdered())
+    {
+        std::vector<uint32_t> codes(leafCount);
+        cloud.ComputeMortonCodes(codes.data());
+        RadixSorter sorter(m_pool);
+        sorter.Sort(codes.data(), level.data(), leafCount);
+    }
+
+    size_t nextNode = leafCount;
+    while (level.size() > 1)
+    {
+        const size_t groupCount = (level.size() + fanOut - 1) / fanOut;
+        const size_t childBase = m_childIndices.size();
+        const size_t parentBase = nextNode;
+        m_childIndices.insert(m_childIndices.end(), level.begin(), level.end());
+
+        // 同一层的子节点要么全是叶子（读原点云），要么全是内部节点（读节点点云，下标减去叶子数）
+        const bool leafLevel = parentBase == leafCount;
+        const GaussianCloud &source = leafLevel ? cloud : tree;
+        const size_t sourceBase = leafLevel ? 0 : leafCount;
+        const float *srcCov[6], *srcDC[3];
+        for (int c = 0; c < 6; ++c)
+            srcCov[c] = source.GetComponent(GaussianCloud::Attribute::Covariance, c);
+        for (int c = 0; c < 3; ++c)
+            srcDC[c] = source.GetComponent(GaussianCloud::Attribute::SHDC, c);
+        const float *srcRest = source.GetAttribute(GaussianCloud::Attribute::SHRest);
+        const size_t srcCount = source.GetCount();
+
+        m_pool.ParallelFor(0, groupCount, MERGE_GRAIN_SIZE, [&](size_t begin, size_t end, unsigned int) {
+            std::vector<double> weights(fanOut);
+            for (size_t g = begin; g < end; ++g)
+            {
+                const size_t first = g * fanOut;
+                const size_t count = std::min(fanOut, level.size() - first);
+                const uint32_t *children = level.data() + first;
+                const size_t p = parentBase + g;
+                const size_t q = p - leafCount; // 父节点在节点点云中的下标
+
+                // 权重 w = α · tr(Σ)；全为 0（如全透明）时退化为等权
+                double weightSum = 0.0, opacitySum = 0.0;
+                for (size_t k = 0; k < count; ++k)
+                {
+                    const size_t i = children[k] - sourceBase;
+                    const double traceI = static_cast<double>(srcCov[0][i]) + srcCov[3][i] + srcCov[5][i];
+                    const float opacityI = m_nodes[children[k]].opacity;
+                    weights[k] = static_cast<double>(opacityI) * traceI;
+                    weightSum += weights[k];
+                    opacitySum += opacityI;
+                }
+                const double coverage = weightSum; // Σ αᵢ · tr(Σᵢ)
+                if (!(weightSum > 0.0))
+                {
+                    std::fill(weights.begin(), weights.begin() + count, 1.0);
+                    weightSum = static_cast<double>(count);
+                }
+                const double invWeight = 1.0 / weightSum;
+
+                double mean[3] = {0.0, 0.0, 0.0};
+                for (size_t k = 0; k < count; ++k)
+                    for (int c = 0; c < 3; ++c)
+                        mean[c] += weights[k] * position[c][children[k]];
+                for (int c = 0; c < 3; ++c)
+                    mean[c] *= invWeight;
+
+                // Σ = Σ w·(Σᵢ + d·dᵀ) / W，d = μᵢ - μ
+                double sigma[6] = {0.0, 0.0, 0.0, 0.0, 0.0, 0.0};
+                float radius = 0.0f;
+                for (size_t k = 0; k < count; ++k)
+                {
+                    const uint32_t n = children[k];
+                    const size_t i = n - sourceBase;
+                    const double d[3] = {position[0][n] - mean[0], position[1][n] - mean[1], position[2][n] - mean[2]};
+                    const double w = weights[k];
+                    sigma[0] += w * (srcCov[0][i] + d[0] * d[0]);
+                    sigma[1] += w * (srcCov[1][i] + d[0] * d[1]);
+                    sigma[2] += w * (srcCov[2][i] + d[0] * d[2]);
+                    sigma[3] += w * (srcCov[3][i] + d[1] * d[1]);
+                    sigma[4] += w * (srcCov[4][i] + d[1] * d[2]);
+                    sigma[5] += w * (srcCov[5][i] + d[2] * d[2]);
+                    const float distance = static_cast<float>(std::sqrt(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]));
+                    radius = std::max(radius, distance + m_nodes[n].radius);
+                }
+                for (int c = 0; c < 6; ++c)
+                    sigma[c] *= invWeight;
+
+                // 特征分解得到缩放（特征值开方）与旋转（特征向量为列，保证行列式为 +1）
+                double matrix[3][3] = {{sigma[0], sigma[1], sigma[2]},
+                                       {sigma[1], sigma[3], sigma[4]},
+                                       {sigma[2], sigma[4], sigma[5]}};
+                double eigenvalues[3], axes[3][3];
+                EigenSymmetric3(matrix, eigenvalues, axes);
+                const double det = axes[0][0] * (axes[1][1] * axes[2][2] - axes[1][2] * axes[2][1]) -
+                                   axes[0][1] * (axes[1][0] * axes[2][2] - axes[1][2] * axes[2][0]) +
+                                   axes[0][2] * (axes[1][0] * axes[2][1] - axes[1][1] * axes[2][0]);
+                if (det < 0.0)
+                    for (int r = 0; r < 3; ++r)
+                        axes[r][2] = -axes[r][2];
+                float quaternion[4];
+                MatrixToQuaternion(axes, quaternion);
+
+                float maxScale = 0.0f;
+                for (int c = 0; c < 3; ++c)
+                {
+                    position[c][p] = static_cast<float>(mean[c]);
+                    scale[c][q] = static_cast<float>(std::sqrt(std::max(eigenvalues[c], 0.0)));
+                    maxScale = std::max(maxScale, scale[c][q]);
+                }
+                for (int c = 0; c < 4; ++c)
+                    rotation[c][q] = quaternion[c];
+                for (int c = 0; c < 6; ++c)
+                    cov[c][q] = static_cast<float>(sigma[c]);
+
+                // 覆盖守恒：父高斯尺寸变大后不透明度相应降低
+                const double parentTrace = sigma[0] + sigma[3] + sigma[5];
+                opacity[q] = parentTrace > 0.0 ? static_cast<float>(std::min(1.0, coverage / parentTrace))
+                                               : static_cast<float>(opacitySum / static_cast<double>(count));
+
+                for (int c = 0; c < 3; ++c)
+                {
+                    double sum = 0.0;
+                    for (size_t k = 0; k < count; ++k)
+                        sum += weights[k] * srcDC[c][children[k] - sourceBase];
+                    shDC[c][q] = static_cast<float>(sum * invWeight);
+                }
+                for (int c = 0; c < restComponents; ++c)
+                {
+                    const float *plane = srcRest + static_cast<size_t>(c) * srcCount;
+                    double sum = 0.0;
+                    for (size_t k = 0; k < count; ++k)
+                        sum += weights[k] * plane[children[k] - sourceBase];
+                    shRest[static_cast<size_t>(c) * internalCount + q] = static_cast<float>(sum * invWeight);
+                }
+
+                SplatLodNode &node = m_nodes[p];
+                node.firstChild = static_cast<uint32_t>(childBase + first);
+                node.childCount = static_cast<uint32_t>(count);
+                node.extent = 3.0f * maxScale;
+                node.radius = std::max(radius, node.extent);
+                node.opacity = opacity[q];
+            }
+        });
+
+        level.resize(groupCount);
+        for (size_t g = 0; g < groupCount; ++g)
+            level[g] = static_cast<uint32_t>(parentBase + g);
+        nextNode += groupCount;
+    }
+}
+
+size_t SplatLodTree::Select(const float *viewMatrix, float focal, float tanHalfFovX, float tanHalfFovY,
+                            float pixelError, const SplatCullParams &params)
+{
+    m_selection.clear();
+    if (m_nodes.empty())
+        return 0;
+
+    const float *v = viewMatrix;
+    const float *position[3] = {GetPosition(0), GetPosition(1), GetPosition(2)};
+    const float limX = params.guardBand * tanHalfFovX;
+    const float limY = params.guardBand * tanHalfFovY;
+    const float sphereScaleX = std::sqrt(1.0f + limX * limX);
+    const float sphereScaleY = std::sqrt(1.0f + limY * limY);
+    const float jacobianLimX = 1.3f * tanHalfFovX;
+    const float jacobianLimY = 1.3f * tanHalfFovY;
+    const float nearClip = params.nearClip;
+    const float minOpacity = params.minOpacity;
+    const float minRadius = params.minRadius;
+    const SplatLodNode *nodes = m_nodes.data();
+    const uint32_t *childIndices = m_childIndices.data();
+
+    // 与 SplatCuller 相同的包围球 - 视锥侧平面测试；内部节点的包围球整体在近平面之前且投影足够小时输出。
+    // 输出前再按节点自身的不透明度与 3σ 范围做 SplatCuller 的不透明度与大小判定，
+    // 不展开时（pixelError 为 0）选择结果与 SplatCuller 对原始点云的剔除结果相同
+    auto classify = [&](uint32_t n) -> NodeAction {
+        const float px = position[0][n], py = position[1][n], pz = position[2][n];
+        const float tx = v[0] * px + v[4] * py + v[8] * pz + v[12];
+        const float ty = v[1] * px + v[5] * py + v[9] * pz + v[13];
+        const float z = -(v[2] * px + v[6] * py + v[10] * pz + v[14]);
+        const SplatLodNode &node = nodes[n];
+        const float radius = node.radius;
+        if (!(z + radius > nearClip) || std::fabs(tx) > limX * z + radius * sphereScaleX ||
+            std::fabs(ty) > limY * z + radius * sphereScaleY)
+            return NODE_CULL;
+        if (node.childCount == 0)
+        {
+            if (!(z > nearClip))
+                return NODE_CULL;
+        }
+        else
+        {
+            const float nearest = z - radius;
+            if (!(nearest > nearClip && radius * focal < pixelError * nearest))
+                return NODE_REFINE;
+        }
+
+        if (node.opacity < minOpacity)
+            return NODE_CULL;
+        if (minRadius > 0.0f)
+        {
+            const float invZ = 1.0f / z;
+            const float u = std::min(std::fabs(tx) * invZ, jacobianLimX);
+            const float w = std::min(std::fabs(ty) * invZ, jacobianLimY);
+            if (node.extent * focal * invZ * std::sqrt(1.0f + u * u + w * w) < minRadius)
+                return NODE_CULL;
+        }
+        return NODE_EMIT;
+    };
+
+    // 串行广度展开到足够多的子树，保证后续并行有足够的任务
+    m_frontier.assign(1, GetRoot());
+    std::vector<uint32_t> next;
+    while (!m_frontier.empty() && m_frontier.size() < SELECT_FRONTIER_SIZE)
+    {
+        next.clear();
+        for (uint32_t n : m_frontier)
+        {
+            const NodeAction action = classify(n);
+            if (action == NODE_EMIT)
+                m_selection.push_back(n);
+            else if (action == NODE_REFINE)
+                next.insert(next.end(), childIndices + nodes[n].firstChild,
+                            childIndices + nodes[n].firstChild + nodes[n].childCount);
+        }
+        m_frontier.swap(next);
+    }
+    if (m_frontier.empty())
+        return m_selection.size();
+
+    // 每块子树独立深度遍历，结果按块顺序拼接，选择结果与线程数无关
+    const size_t blockCount = (m_frontier.size() + SELECT_GRAIN_SIZE - 1) / SELECT_GRAIN_SIZE;
+    if (m_blockSelections.size() < blockCount)
+        m_blockSelections.resize(blockCount);
+    m_pool.ParallelFor(0, m_frontier.size(), SELECT_GRAIN_SIZE, [&](size_t begin, size_t end, unsigned int) {
+        std::vector<uint32_t> &out = m_blockSelections[begin / SELECT_GRAIN_SIZE];
+        out.clear();
+        std::vector<uint32_t> stack;
+        for (size_t f = begin; f < end; ++f)
+        {
+            stack.push_back(m_frontier[f]);
+            while (!stack.empty())
+            {
+                const uint32_t n = stack.back();
+                stack.pop_back();
+                const NodeAction action = classify(n);
+                if (action == NODE_EMIT)
+                    out.push_back(n);
+                else if (action == NODE_REFINE)
+                    stack.insert(stack.end(), childIndices + nodes[n].firstChild,
+                                 childIndices + nodes[n].firstChild + nodes[n].childCount);
+            }
+        }
+    });
+
+    size_t total = m_selection.size();
+    for (size_t b = 0; b < blockCount; ++b)
+        total += m_blockSelections[b].size();
+    m_selection.reserve(total);
+    for (size_t b = 0; b < blockCount; ++b)
+        m_selection.insert(m_selection.end(), m_blockSelections[b].begin(), m_blockSelections[b].end());
+    return m_selection.size();
+}
+
+RENDERER_NAMESPACE_END
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "Core/RenderCore.h"
+#include "Core/ThreadPool.h"
+#include "Splat/GaussianCloud.h"
+#include "Splat/SplatCuller.h"
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+RENDERER_NAMESPACE_BEGIN
+
+/// LOD 树节点；节点 i < 叶子数时即原点云的第 i 个高斯，否则为 GetNodeCloud() 中的第 i - 叶子数个高斯
+struct SplatLodNode
+{
+    uint32_t firstChild = 0; // 子节点在 GetChildIndices() 中的区间起点，叶子无子节点
+    uint32_t childCount = 0;
+    float radius = 0.0f;  // 以节点高斯中心为球心、包住全部后代 3σ 范围的包围球半径
+    float extent = 0.0f;  // 节点高斯自身的 3σ 范围（3 · 最大缩放），用于大小剔除
+    float opacity = 0.0f; // 节点高斯的不透明度，用于不透明度剔除
+};
+
+/// 高斯点云的层次 LOD：沿 Morton 序每 branching 个相邻节点合并为一个父高斯，逐层向上直到只剩根
+///
+/// 父高斯按矩匹配合并，权重 w = α · tr(Σ)（不透明度 × 尺寸）：
+///   μ = Σ w·μᵢ / W，Σ = Σ w·(Σᵢ + (μᵢ - μ)(μᵢ - μ)ᵀ) / W，球谐系数取加权平均，
+///   α = min(1, Σ αᵢ·tr(Σᵢ) / tr(Σ))（覆盖面积守恒），缩放与旋转由 Σ 的特征分解得到
+/// 叶子即原始高斯且下标不变，内部节点编号接在其后。树只在 GetNodeCloud() 中保存内部节点，
+/// 叶子数据不复制（原点云可以是零拷贝映射的缓存）；上传时把两者按属性平面拼接成一个点云布局。
+/// 全部节点的位置另存一份合成平面（GetPosition），供选择与 CPU 排序按节点下标读取。
+///
+/// 每帧 Select() 自根向下遍历：包围球在（带保护带的）视锥外的子树跳过，
+/// 包围球投影半径小于允许的像素误差的节点直接作为代表输出，否则展开子节点；
+/// 输出的节点再做与 SplatCuller 相同的不透明度与大小判定。
+/// 远处区域因此只输出少量合并高斯，近处仍是原始高斯。
+class RENDERER_API SplatLodTree
+{
+public:
+    static constexpr int DEFAULT_BRANCHING = 8;
+
+    explicit SplatLodTree(ThreadPool &pool = ThreadPool::Global());
+
+    SplatLodTree(const SplatLodTree &) = delete;
+    SplatLodTree &operator=(const SplatLodTree &) = delete;
+
+    /// 由点云构建（需已计算 Covariance 属性），加载后调用一次；构建后不再引用原点云
+    void Build(const GaussianCloud &cloud, int branching = DEFAULT_BRANCHING);
+    void Clear();
+
+    bool IsEmpty() const
+    {
+        return m_nodes.empty();
+    }
+    /// 内部节点组成的点云（第 i 个高斯即节点 叶子数 + i）
+    const std::shared_ptr<GaussianCloud> &GetNodeCloud() const
+    {
+        return m_cloud;
+    }
+    /// 叶子 + 内部节点数
+    size_t GetNodeCount() const
+    {
+        return m_nodes.size();
+    }
+    /// 全部节点位置的第 component 个分量平面，长度为 GetNodeCount()
+    const float *GetPosition(int component) const
+    {
+        return m_positions.data() + static_cast<size_t>(component) * m_nodes.size();
+    }
+    const std::vector<SplatLodNode> &GetNodes() const
+    {
+        return m_nodes;
+    }
+    const std::vector<uint32_t> &GetChildIndices() const
+    {
+        return m_childIndices;
+    }
+    size_t GetLeafCount() const
+    {
+        return m_leafCount;
+    }
+    uint32_t GetRoot() const
+    {
+        return static_cast<uint32_t>(m_nodes.size() - 1);
+    }
+
+    /// 按屏幕空间误差选择节点，返回选中数
+    /// @param viewMatrix/focal/tanHalfFovX/Y 含义同 SplatCuller::SetView（focal 取两轴较大值）
+    /// @param pixelError 允许的节点包围球投影半径（像素）
+    /// @param params 剔除阈值，含义同 SplatCuller；minOpacity / minRadius 为 0 时只做视锥与近平面判定
+    size_t Select(const float *viewMatrix, float focal, float tanHalfFovX, float tanHalfFovY, float pixelError,
+                  const SplatCullParams &params = SplatCullParams());
+    /// 选中节点的下标（即叶子 + 内部节点的合成下标）
+    const std::vector<uint32_t> &GetSelection() const
+    {
+        return m_selection;
+    }
+
+private:
+    ThreadPool &m_pool;
+    std::shared_ptr<GaussianCloud> m_cloud;
+    std::vector<SplatLodNode> m_nodes;
+    std::vector<uint32_t> m_childIndices;
+    std::vector<float> m_positions; // 全部节点的位置，3 个分量平面依次存放
+    size_t m_leafCount = 0;
+
+    std::vector<uint32_t> m_selection;
+    std::vector<uint32_t> m_frontier;
+    std::vector<std::vector<uint32_t>> m_blockSelections;
+};
+
+RENDERER_NAMESPACE_END
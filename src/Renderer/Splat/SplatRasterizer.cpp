@@ -0,0 +1,461 @@
+#include "Splat/SplatRasterizer.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+
+#if RENDERER_ARCH_X86
+#include <immintrin.h>
+#endif
+
+RENDERER_NAMESPACE_BEGIN
+
+namespace
+{
+// m_splatData 中各平面的序号
+enum SplatPlane
+{
+    PLANE_COV2D = 0,
+    PLANE_CONIC = 3,
+    PLANE_RADIUS = 6,
+    PLANE_DEPTH = 7,
+    PLANE_MEAN2D = 8,
+    PLANE_COUNT = 10
+};
+
+const float NEAR_CLIP = 0.01f;
+const float MAX_ALPHA = 0.99f;
+const float MIN_ALPHA = 1.0f / 255.0f;
+const size_t PROJECT_GRAIN_SIZE = 16384;
+const size_t CHUNK_GRAIN_SIZE = 64;
+
+const int TILE = TileBinner::TILE_SIZE;
+const int TILE_PIXELS = TILE * TILE;
+// 逐像素求值的分组宽度：每行 TILE / SPAN_WIDTH 组，各内核按组覆盖相同的像素集合，结果一致
+const int SPAN_WIDTH = 8;
+
+inline int CountMaskBits(int mask)
+{
+    int n = 0;
+    for (; mask != 0; mask &= mask - 1)
+        ++n;
+    return n;
+}
+
+/// 分块光栅化所需的逐高斯数据
+struct RasterInputs
+{
+    const float *mean[2];
+    const float *conic[3];
+    const float *radius;
+    const float *opacity;
+    const float *color[3];
+};
+
+/// 一个分块的合成状态；done 为全 1 / 全 0 的掩码，便于直接作为 SIMD 掩码加载
+struct alignas(32) TileState
+{
+    float transmittance[TILE_PIXELS];
+    float color[3][TILE_PIXELS];
+    uint32_t done[TILE_PIXELS];
+    int doneCount;
+};
+
+/// 高斯在分块内的行范围与 8 像素组范围（由 3σ 方形范围截断到分块）
+struct SplatFootprint
+{
+    int rowBegin, rowEnd;
+    int spanBegin, spanEnd;
+};
+
+inline bool ComputeFootprint(float mx, float my, float r, int tileX0, int tileY0, SplatFootprint &fp)
+{
+    fp.rowBegin = std::max(0, static_cast<int>(std::floor(my - r)) - tileY0);
+    fp.rowEnd = std::min(TILE, static_cast<int>(std::ceil(my + r)) - tileY0);
+    const int colBegin = std::max(0, static_cast<int>(std::floor(mx - r)) - tileX0);
+    const int colEnd = std::min(TILE, static_cast<int>(std::ceil(mx + r)) - tileX0);
+    fp.spanBegin = colBegin / SPAN_WIDTH;
+    fp.spanEnd = (colEnd + SPAN_WIDTH - 1) / SPAN_WIDTH;
+    return fp.rowBegin < fp.rowEnd && colBegin < colEnd;
+}
+
+// ---- 标量内核 ----
+void BlendSplatScalar(TileState &state, const RasterInputs &in, uint32_t s, int tileX0, int tileY0,
+                      const SplatFootprint &fp)
+{
+    const float mx = in.mean[0][s], my = in.mean[1][s];
+    const float ca = in.conic[0][s], cb = in.conic[1][s], cc = in.conic[2][s];
+    const float opacity = in.opacity[s];
+    const float cr = in.color[0][s], cg = in.color[1][s], cbl = in.color[2][s];
+    for (int row = fp.rowBegin; row < fp.rowEnd; ++row)
+    {
+        const float dy = static_cast<float>(tileY0 + row) + 0.5f - my;
+        for (int col = fp.spanBegin * SPAN_WIDTH; col < fp.spanEnd * SPAN_WIDTH; ++col)
+        {
+            const int p = row * TILE + col;
+            if (state.done[p])
+                continue;
+            const float dx = static_cast<float>(tileX0 + col) + 0.5f - mx;
+            const float power = -0.5f * (ca * dx * dx + cc * dy * dy) - cb * dx * dy;
+            if (power > 0.0f)
+                continue;
+            const float alpha = std::min(MAX_ALPHA, opacity * std::exp(power));
+            if (alpha < MIN_ALPHA)
+                continue;
+            const float T = state.transmittance[p];
+            const float testT = T * (1.0f - alpha);
+            if (testT < SplatRasterizer::MIN_TRANSMITTANCE)
+            {
+                state.done[p] = 0xFFFFFFFFu;
+                ++state.doneCount;
+                continue;
+            }
+            const float weight = alpha * T;
+            state.color[0][p] += cr * weight;
+            state.color[1][p] += cg * weight;
+            state.color[2][p] += cbl * weight;
+            state.transmittance[p] = testT;
+        }
+    }
+}
+
+#if RENDERER_ARCH_X86
+// ---- SSE4.1 内核：每组 8 像素拆为两次 4 路 ----
+// exp 使用 Cephes 多项式近似（相对误差约 1e-7），输入已保证 <= 0
+RENDERER_TARGET_SSE41 inline __m128 ExpSSE4(__m128 x)
+{
+    x = _mm_max_ps(x, _mm_set1_ps(-87.0f));
+    __m128 fx = _mm_floor_ps(_mm_add_ps(_mm_mul_ps(x, _mm_set1_ps(1.44269504088896341f)), _mm_set1_ps(0.5f)));
+    x = _mm_sub_ps(x, _mm_mul_ps(fx, _mm_set1_ps(0.693359375f)));
+    x = _mm_sub_ps(x, _mm_mul_ps(fx, _mm_set1_ps(-2.12194440e-4f)));
+    __m128 y = _mm_set1_ps(1.9875691500e-4f);
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(1.3981999507e-3f));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(8.3334519073e-3f));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(4.1665795894e-2f));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(1.6666665459e-1f));
+    y = _mm_add_ps(_mm_mul_ps(y, x), _mm_set1_ps(5.0000001201e-1f));
+    y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(y, _mm_mul_ps(x, x)), x), _mm_set1_ps(1.0f));
+    const __m128i pow2n = _mm_slli_epi32(_mm_add_epi32(_mm_cvttps_epi32(fx), _mm_set1_epi32(127)), 23);
+    return _mm_mul_ps(y, _mm_castsi128_ps(pow2n));
+}
+
+RENDERER_TARGET_SSE41 void BlendSplatSSE4(TileState &state, const RasterInputs &in, uint32_t s, int tileX0,
+                                          int tileY0, const SplatFootprint &fp)
+{
+    const __m128 mx = _mm_set1_ps(in.mean[0][s]);
+    const __m128 negHalfA = _mm_set1_ps(-0.5f * in.conic[0][s]);
+    const __m128 negB = _mm_set1_ps(-in.conic[1][s]);
+    const __m128 negHalfC = _mm_set1_ps(-0.5f * in.conic[2][s]);
+    const __m128 opacity = _mm_set1_ps(in.opacity[s]);
+    const __m128 cr = _mm_set1_ps(in.color[0][s]), cg = _mm_set1_ps(in.color[1][s]);
+    const __m128 cbl = _mm_set1_ps(in.color[2][s]);
+    const __m128 zero = _mm_setzero_ps(), one = _mm_set1_ps(1.0f);
+    const __m128 maxAlpha = _mm_set1_ps(MAX_ALPHA), minAlpha = _mm_set1_ps(MIN_ALPHA);
+    const __m128 minT = _mm_set1_ps(SplatRasterizer::MIN_TRANSMITTANCE);
+    const __m128 laneOffset = _mm_setr_ps(0.5f, 1.5f, 2.5f, 3.5f);
+    const float my = in.mean[1][s];
+
+    for (int row = fp.rowBegin; row < fp.rowEnd; ++row)
+    {
+        const float dyScalar = static_cast<float>(tileY0 + row) + 0.5f - my;
+        const __m128 dy = _mm_set1_ps(dyScalar);
+        const __m128 dyTerm = _mm_mul_ps(negHalfC, _mm_mul_ps(dy, dy));
+        const __m128 bdy = _mm_mul_ps(negB, dy);
+        for (int col = fp.spanBegin * SPAN_WIDTH; col < fp.spanEnd * SPAN_WIDTH; col += 4)
+        {
+            const int p = row * TILE + col;
+            const __m128 done = _mm_load_ps(reinterpret_cast<const float *>(state.done + p));
+            if (_mm_movemask_ps(done) == 0xF)
+                continue;
+            const __m128 dx =
+                _mm_sub_ps(_mm_add_ps(_mm_set1_ps(static_cast<float>(tileX0 + col)), laneOffset), mx);
+            const __m128 power =
+                _mm_add_ps(_mm_add_ps(_mm_mul_ps(negHalfA, _mm_mul_ps(dx, dx)), dyTerm), _mm_mul_ps(bdy, dx));
+            const __m128 alpha = _mm_min_ps(maxAlpha, _mm_mul_ps(opacity, ExpSSE4(_mm_min_ps(power, zero))));
+            const __m128 valid = _mm_andnot_ps(
+                done, _mm_and_ps(_mm_cmple_ps(power, zero), _mm_cmpge_ps(alpha, minAlpha)));
+            if (_mm_movemask_ps(valid) == 0)
+                continue;
+
+            const __m128 T = _mm_load_ps(state.transmittance + p);
+            const __m128 testT = _mm_mul_ps(T, _mm_sub_ps(one, alpha));
+            const __m128 finish = _mm_and_ps(valid, _mm_cmplt_ps(testT, minT));
+            const __m128 accumulate = _mm_andnot_ps(finish, valid);
+            const __m128 weight = _mm_and_ps(_mm_mul_ps(alpha, T), accumulate);
+            _mm_store_ps(state.color[0] + p, _mm_add_ps(_mm_load_ps(state.color[0] + p), _mm_mul_ps(cr, weight)));
+            _mm_store_ps(state.color[1] + p, _mm_add_ps(_mm_load_ps(state.color[1] + p), _mm_mul_ps(cg, weight)));
+            _mm_store_ps(state.color[2] + p, _mm_add_ps(_mm_load_ps(state.color[2] + p), _mm_mul_ps(cbl, weight)));
+            _mm_store_ps(state.transmittance + p, _mm_blendv_ps(T, testT, accumulate));
+            _mm_store_ps(reinterpret_cast<float *>(state.done + p), _mm_or_ps(done, finish));
+            state.doneCount += CountMaskBits(_mm_movemask_ps(finish));
+        }
+    }
+}
+
+// ---- AVX2 内核：每组 8 像素一次处理 ----
+RENDERER_TARGET_AVX2 inline __m256 ExpAVX2(__m256 x)
+{
+    x = _mm256_max_ps(x, _mm256_set1_ps(-87.0f));
+    __m256 fx = _mm256_floor_ps(
+        _mm256_add_ps(_mm256_mul_ps(x, _mm256_set1_ps(1.44269504088896341f)), _mm256_set1_ps(0.5f)));
+    x = _mm256_sub_ps(x, _mm256_mul_ps(fx, _mm256_set1_ps(0.693359375f)));
+    x = _mm256_sub_ps(x, _mm256_mul_ps(fx, _mm256_set1_ps(-2.12194440e-4f)));
+    __m256 y = _mm256_set1_ps(1.9875691500e-4f);
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(1.3981999507e-3f));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(8.3334519073e-3f));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(4.1665795894e-2f));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(1.6666665459e-1f));
+    y = _mm256_add_ps(_mm256_mul_ps(y, x), _mm256_set1_ps(5.0000001201e-1f));
+    y = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(y, _mm256_mul_ps(x, x)), x), _mm256_set1_ps(1.0f));
+    const __m256i pow2n =
+        _mm256_slli_epi32(_mm256_add_epi32(_mm256_cvttps_epi32(fx), _mm256_set1_epi32(127)), 23);
+    return _mm256_mul_ps(y, _mm256_castsi256_ps(pow2n));
+}
+
+RENDERER_TARGET_AVX2 void BlendSplatAVX2(TileState &state, const RasterInputs &in, uint32_t s, int tileX0,
+                                         int tileY0, const SplatFootprint &fp)
+{
+    const __m256 mx = _mm256_set1_ps(in.mean[0][s]);
+    const __m256 negHalfA = _mm256_set1_ps(-0.5f * in.conic[0][s]);
+    const __m256 negB = _mm256_set1_ps(-in.conic[1][s]);
+    const __m256 negHalfC = _mm256_set1_ps(-0.5f * in.conic[2][s]);
+    const __m256 opacity = _mm256_set1_ps(in.opacity[s]);
+    const __m256 cr = _mm256_set1_ps(in.color[0][s]), cg = _mm256_set1_ps(in.color[1][s]);
+    const __m256 cbl = _mm256_set1_ps(in.color[2][s]);
+    const __m256 zero = _mm256_setzero_ps(), one = _mm256_set1_ps(1.0f);
+    const __m256 maxAlpha = _mm256_set1_ps(MAX_ALPHA), minAlpha = _mm256_set1_ps(MIN_ALPHA);
+    const __m256 minT = _mm256_set1_ps(SplatRasterizer::MIN_TRANSMITTANCE);
+    const __m256 laneOffset = _mm256_setr_ps(0.5f, 1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f);
+    const float my = in.mean[1][s];
+
+    for (int row = fp.rowBegin; row < fp.rowEnd; ++row)
+    {
+        const __m256 dy = _mm256_set1_ps(static_cast<float>(tileY0 + row) + 0.5f - my);
+        const __m256 dyTerm = _mm256_mul_ps(negHalfC, _mm256_mul_ps(dy, dy));
+        const __m256 bdy = _mm256_mul_ps(negB, dy);
+        for (int span = fp.spanBegin; span < fp.spanEnd; ++span)
+        {
+            const int col = span * SPAN_WIDTH;
+            const int p = row * TILE + col;
+            const __m256 done = _mm256_load_ps(reinterpret_cast<const float *>(state.done + p));
+            if (_mm256_movemask_ps(done) == 0xFF)
+                continue;
+            const __m256 dx =
+                _mm256_sub_ps(_mm256_add_ps(_mm256_set1_ps(static_cast<float>(tileX0 + col)), laneOffset), mx);
+            const __m256 power = _mm256_add_ps(
+                _mm256_add_ps(_mm256_mul_ps(negHalfA, _mm256_mul_ps(dx, dx)), dyTerm), _mm256_mul_ps(bdy, dx));
+            const __m256 alpha =
+                _mm256_min_ps(maxAlpha, _mm256_mul_ps(opacity, ExpAVX2(_mm256_min_ps(power, zero))));
+            const __m256 valid = _mm256_andnot_ps(done, _mm256_and_ps(_mm256_cmp_ps(power, zero, _CMP_LE_OQ),
+                                                                      _mm256_cmp_ps(alpha, minAlpha, _CMP_GE_OQ)));
+            if (_mm256_movemask_ps(valid) == 0)
+                continue;
+
+            const __m256 T = _mm256_load_ps(state.transmittance + p);
+            const __m256 testT = _mm256_mul_ps(T, _mm256_sub_ps(one, alpha));
+            const __m256 finish = _mm256_and_ps(valid, _mm256_cmp_ps(testT, minT, _CMP_LT_OQ));
+            const __m256 accumulate = _mm256_andnot_ps(finish, valid);
+            const __m256 weight = _mm256_and_ps(_mm256_mul_ps(alpha, T), accumulate);
+            _mm256_store_ps(state.color[0] + p,
+                            _mm256_add_ps(_mm256_load_ps(state.color[0] + p), _mm256_mul_ps(cr, weight)));
+            _mm256_store_ps(state.color[1] + p,
+                            _mm256_add_ps(_mm256_load_ps(state.color[1] + p), _mm256_mul_ps(cg, weight)));
+            _mm256_store_ps(state.color[2] + p,
+                            _mm256_add_ps(_mm256_load_ps(state.color[2] + p), _mm256_mul_ps(cbl, weight)));
+            _mm256_store_ps(state.transmittance + p, _mm256_blendv_ps(T, testT, accumulate));
+            _mm256_store_ps(reinterpret_cast<float *>(state.done + p), _mm256_or_ps(done, finish));
+            state.doneCount += CountMaskBits(_mm256_movemask_ps(finish));
+        }
+    }
+}
+#endif // RENDERER_ARCH_X86
+} // namespace
+
+SplatRasterizer::SplatRasterizer(ThreadPool &pool)
+    : m_pool(pool), m_binner(pool), m_chunks(pool), m_colorCache(pool), m_level(CpuFeatures::GetSIMDLevel())
+{
+}
+
+void SplatRasterizer::SetSIMDLevel(CpuFeatures::SIMDLevel level)
+{
+    m_level = std::min(level, CpuFeatures::GetSIMDLevel());
+    m_projector.SetSIMDLevel(m_level);
+    m_colorCache.SetSIMDLevel(m_level);
+}
+
+void SplatRasterizer::Render(const GaussianCloud &cloud, const float *viewMatrix, const float *projMatrix,
+                             int width, int height)
+{
+    const auto startTime = std::chrono::steady_clock::now();
+    m_width = std::max(width, 0);
+    m_height = std::max(height, 0);
+    m_image.assign(static_cast<size_t>(m_width) * m_height * 4, 0.0f);
+    m_stats = Stats();
+    if (cloud.GetCount() == 0 || m_image.empty())
+        return;
+
+    m_splatData.resize(cloud.GetCount() * PLANE_COUNT);
+    Project(cloud, viewMatrix, projMatrix);
+    ComputeColors(cloud, viewMatrix);
+
+    const size_t count = cloud.GetCount();
+    const float *data = m_splatData.data();
+    const float *mean2D[2] = {data + PLANE_MEAN2D * count, data + (PLANE_MEAN2D + 1) * count};
+    m_binner.Bin(mean2D, data + PLANE_RADIUS * count, data + PLANE_DEPTH * count, count, m_width, m_height);
+    m_stats.instanceCount = m_binner.GetInstanceCount();
+
+    RasterizeTiles(cloud);
+
+    m_stats.milliseconds =
+        std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - startTime).count();
+}
+
+void SplatRasterizer::Project(const GaussianCloud &cloud, const float *viewMatrix, const float *projMatrix)
+{
+    // 与 SplatPass 相同：由投影矩阵推出像素焦距与半视场角，主点位于图像中心
+    const float width = static_cast<float>(m_width);
+    const float height = static_cast<float>(m_height);
+    m_projector.SetView(viewMatrix, projMatrix[0] * width * 0.5f, projMatrix[5] * height * 0.5f,
+                        1.0f / projMatrix[0], 1.0f / projMatrix[5], NEAR_CLIP);
+    m_projector.SetPrincipalPoint(width * 0.5f, height * 0.5f);
+
+    const size_t count = cloud.GetCount();
+    float *data = m_splatData.data();
+    SplatProjectionOutput output;
+    for (int c = 0; c < 3; ++c)
+    {
+        output.cov2D[c] = data + (PLANE_COV2D + c) * count;
+        output.conic[c] = data + (PLANE_CONIC + c) * count;
+    }
+    output.radius = data + PLANE_RADIUS * count;
+    output.depth = data + PLANE_DEPTH * count;
+    output.mean2D[0] = data + PLANE_MEAN2D * count;
+    output.mean2D[1] = data + (PLANE_MEAN2D + 1) * count;
+
+    const float *position[3];
+    const float *covariance[6];
+    for (int c = 0; c < 3; ++c)
+        position[c] = cloud.GetComponent(GaussianCloud::Attribute::Position, c);
+    for (int c = 0; c < 6; ++c)
+        covariance[c] = cloud.GetComponent(GaussianCloud::Attribute::Covariance, c);
+
+    m_pool.ParallelFor(0, count, PROJECT_GRAIN_SIZE, [&](size_t begin, size_t end, unsigned int) {
+        m_projector.Project(position, covariance, begin, end, output);
+    });
+}
+
+void SplatRasterizer::ComputeColors(const GaussianCloud &cloud, const float *viewMatrix)
+{
+    // 点云变化时重建分块（Morton 序点云的分块即连续下标区间）
+    if (cloud.GetStorage() != m_chunkStorage || m_chunks.GetSplatCount() != cloud.GetCount())
+    {
+        m_chunks.Build(cloud);
+        m_chunkStorage = cloud.GetStorage();
+    }
+
+    // 只为含可见高斯的块求颜色
+    const std::vector<SplatChunk> &chunks = m_chunks.GetChunks();
+    const uint32_t *indices = m_chunks.GetIndices().data();
+    const float *radius = m_splatData.data() + PLANE_RADIUS * cloud.GetCount();
+    m_chunkActive.resize(chunks.size());
+    std::vector<size_t> chunkVisible(chunks.size(), 0);
+    m_pool.ParallelFor(0, chunks.size(), CHUNK_GRAIN_SIZE, [&](size_t begin, size_t end, unsigned int) {
+        for (size_t c = begin; c < end; ++c)
+        {
+            size_t visible = 0;
+            for (size_t k = chunks[c].begin; k < chunks[c].begin + chunks[c].count; ++k)
+                visible += radius[indices[k]] > 0.0f ? 1 : 0;
+            chunkVisible[c] = visible;
+            m_chunkActive[c] = visible > 0 ? 1 : 0;
+        }
+    });
+    for (size_t visible : chunkVisible)
+        m_stats.visibleCount += visible;
+
+    float camera[3];
+    SHEvaluator::GetCameraPosition(viewMatrix, camera);
+    m_colorCache.Update(cloud, m_chunks, camera, m_chunkActive.data());
+}
+
+void SplatRasterizer::RasterizeTiles(const GaussianCloud &cloud)
+{
+    const size_t count = cloud.GetCount();
+    const float *data = m_splatData.data();
+    RasterInputs in;
+    in.mean[0] = data + PLANE_MEAN2D * count;
+    in.mean[1] = data + (PLANE_MEAN2D + 1) * count;
+    for (int c = 0; c < 3; ++c)
+    {
+        in.conic[c] = data + (PLANE_CONIC + c) * count;
+        in.color[c] = m_colorCache.GetColor(c);
+    }
+    in.radius = data + PLANE_RADIUS * count;
+    in.opacity = cloud.GetComponent(GaussianCloud::Attribute::Opacity, 0);
+
+    using BlendFunc = void (*)(TileState &, const RasterInputs &, uint32_t, int, int, const SplatFootprint &);
+    BlendFunc blend = BlendSplatScalar;
+#if RENDERER_ARCH_X86
+    if (m_level == CpuFeatures::SIMDLevel::AVX2)
+        blend = BlendSplatAVX2;
+    else if (m_level == CpuFeatures::SIMDLevel::SSE41)
+        blend = BlendSplatSSE4;
+#endif
+
+    const int tilesX = m_binner.GetTilesX();
+    const size_t tileCount = static_cast<size_t>(tilesX) * m_binner.GetTilesY();
+    const std::vector<TileRange> &ranges = m_binner.GetTileRanges();
+    const uint32_t *splatList = m_binner.GetSplatList().data();
+
+    // 每块工作量差异大，逐块动态分发
+    m_pool.ParallelFor(0, tileCount, 1, [&](size_t tileBegin, size_t tileEnd, unsigned int) {
+        TileState state;
+        for (size_t tile = tileBegin; tile < tileEnd; ++tile)
+        {
+            const TileRange range = ranges[tile];
+            if (range.begin == range.end)
+                continue;
+            const int tileX0 = static_cast<int>(tile % tilesX) * TILE;
+            const int tileY0 = static_cast<int>(tile / tilesX) * TILE;
+            const int validW = std::min(TILE, m_width - tileX0);
+            const int validH = std::min(TILE, m_height - tileY0);
+
+            // 图像外的像素预先标记为已终止
+            state.doneCount = 0;
+            for (int row = 0; row < TILE; ++row)
+            {
+                for (int col = 0; col < TILE; ++col)
+                {
+                    const int p = row * TILE + col;
+                    const bool outside = row >= validH || col >= validW;
+                    state.transmittance[p] = 1.0f;
+                    state.color[0][p] = state.color[1][p] = state.color[2][p] = 0.0f;
+                    state.done[p] = outside ? 0xFFFFFFFFu : 0u;
+                    state.doneCount += outside ? 1 : 0;
+                }
+            }
+
+            SplatFootprint fp;
+            for (uint32_t i = range.begin; i < range.end && state.doneCount < TILE_PIXELS; ++i)
+            {
+                const uint32_t s = splatList[i];
+                if (ComputeFootprint(in.mean[0][s], in.mean[1][s], in.radius[s], tileX0, tileY0, fp))
+                    blend(state, in, s, tileX0, tileY0, fp);
+            }
+
+            for (int row = 0; row < validH; ++row)
+            {
+                float *dst = m_image.data() + (static_cast<size_t>(tileY0 + row) * m_width + tileX0) * 4;
+                for (int col = 0; col < validW; ++col)
+                {
+                    const int p = row * TILE + col;
+                    dst[col * 4 + 0] = state.color[0][p];
+                    dst[col * 4 + 1] = state.color[1][p];
+                    dst[col * 4 + 2] = state.color[2][p];
+                    dst[col * 4 + 3] = 1.0f - state.transmittance[p];
+                }
+            }
+        }
+    });
+}
+
+RENDERER_NAMESPACE_END
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "Core/CpuFeatures.h"
+#include "Core/RenderCore.h"
+#include "Core/ThreadPool.h"
+#include "Splat/CovarianceProjector.h"
+#include "Splat/GaussianCloud.h"
+#include "Splat/SplatChunkSet.h"
+#include "Splat/SplatColorCache.h"
+#include "Splat/TileBinner.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+RENDERER_NAMESPACE_BEGIN
+
+/// 3DGS 软件光栅化器（CPU 分块前向渲染，无需 GL 上下文）
+///
+/// 1. CovarianceProjector 批量投影；含可见高斯的块由 SplatColorCache 按视线方向求球谐 RGB，
+///    相机移动很小时沿用上一帧的颜色
+/// 2. TileBinner 分块并按深度排序，得到每个 16x16 分块从近到远的高斯列表
+/// 3. 分块分发到线程池，块内逐高斯从前往后合成：C += c·α·T，T *= (1 - α)，
+///    T 低于 1e-4 的像素提前终止，整块像素都终止后跳过剩余高斯。逐像素高斯求值按 8 像素一组做 SIMD
+///
+/// 与 SplatPass 的 GL 路径使用同一套约定（0.3 低通、α 上限 0.99、下限 1/255）；分块范围取 3σ 方形，
+/// GL 面片为按不透明度收紧的有向四边形，两者只在 α 接近 1/255 的边缘略有差异。
+/// 结果只取决于输入，与线程数无关，可作为 GL 渲染的对照参考，也用于无 GPU 的批处理节点。
+/// 命令行工具 SplatRenderTool（BUILD_TOOLS）用它离线渲染，并与 SplatPass::RequestCapture 的读回对比。
+///
+/// 输出为 RGBA float 图像：RGB 为预乘颜色（未叠加背景），A = 1 - T；
+/// 行从下往上存放（与 GL 纹理一致，y 轴向上），可直接交给 Texture2D::setFloatData 上传。
+class RENDERER_API SplatRasterizer
+{
+public:
+    static constexpr float MIN_TRANSMITTANCE = 1e-4f;
+
+    /// 最近一次渲染的统计
+    struct Stats
+    {
+        size_t visibleCount = 0;  // 半径大于 0 的高斯数
+        size_t instanceCount = 0; // 分块实例总数
+        double milliseconds = 0.0;
+    };
+
+    explicit SplatRasterizer(ThreadPool &pool = ThreadPool::Global());
+
+    SplatRasterizer(const SplatRasterizer &) = delete;
+    SplatRasterizer &operator=(const SplatRasterizer &) = delete;
+
+    /// 渲染一帧
+    /// @param viewMatrix 列主序视图矩阵（相机看向 -Z）
+    /// @param projMatrix 列主序透视投影矩阵，用于推出焦距与视场角（与 RenderContext::projMatrix 一致）
+    void Render(const GaussianCloud &cloud, const float *viewMatrix, const float *projMatrix, int width,
+                int height);
+
+    /// RGBA float 图像，长度 width * height * 4
+    const std::vector<float> &GetImage() const
+    {
+        return m_image;
+    }
+    int GetWidth() const
+    {
+        return m_width;
+    }
+    int GetHeight() const
+    {
+        return m_height;
+    }
+    const Stats &GetStats() const
+    {
+        return m_stats;
+    }
+
+    /// 强制指定内核（用于对比测试），不支持的等级会自动降级
+    void SetSIMDLevel(CpuFeatures::SIMDLevel level);
+    CpuFeatures::SIMDLevel GetSIMDLevel() const
+    {
+        return m_level;
+    }
+
+    /// 颜色缓存允许的最大视线方向变化（弧度），0 表示每帧重新求值，见 SplatColorCache
+    void SetColorCacheAngle(float radians)
+    {
+        m_colorCache.SetAngleThreshold(radians);
+    }
+    const SplatColorCache::Stats &GetColorCacheStats() const
+    {
+        return m_colorCache.GetStats();
+    }
+
+private:
+    void Project(const GaussianCloud &cloud, const float *viewMatrix, const float *projMatrix);
+    void ComputeColors(const GaussianCloud &cloud, const float *viewMatrix);
+    void RasterizeTiles(const GaussianCloud &cloud);
+
+    ThreadPool &m_pool;
+    CovarianceProjector m_projector;
+    TileBinner m_binner;
+    SplatChunkSet m_chunks;
+    SplatColorCache m_colorCache;
+    CpuFeatures::SIMDLevel m_level;
+
+    int m_width = 0;
+    int m_height = 0;
+    // 逐高斯中间结果（SoA 平面，每个长度为高斯数）：cov2D x3, conic x3, radius, depth, mean2D x2
+    std::vector<float> m_splatData;
+    const unsigned char *m_chunkStorage = nullptr; // m_chunks 对应的点云存储
+    std::vector<uint8_t> m_chunkActive;            // 本帧含可见高斯的块
+    std::vector<float> m_image;
+    Stats m_stats;
+};
+
+RENDERER_NAMESPACE_END
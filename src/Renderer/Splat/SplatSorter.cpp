@@ -0,0 +1,354 @@
+#include "Splat/SplatSorter.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <limits>
+
+RENDERER_NAMESPACE_BEGIN
+
+namespace
+{
+const size_t KEY_GRAIN_SIZE = 65536;
+// 自适应排序中每块至少包含的元素数
+const size_t MIN_SORT_BLOCK = 65536;
+// 插入排序的移动量预算（每个元素平均允许的移动次数），超出说明顺序变化较大，改用基数排序
+const size_t INSERTION_MOVE_BUDGET = 8;
+// 估计无序度时抽样的相邻对数
+const size_t DISORDER_SAMPLE_COUNT = 4096;
+// 连续退回完整排序这么多帧后进入退避，不再尝试沿用排列
+const int FALLBACK_BACKOFF_FRAMES = 3;
+// 退避期间视线方向的帧间变化不超过这么多个量化区间（按深度范围归一）时重新尝试
+const float STILL_KEY_STEPS = 4.0f;
+
+// 视空间深度 = -(view 第 3 行 · p + t.z)，列主序下第 3 行为 m[2], m[6], m[10], m[14]
+inline float ViewDepth(const float *const *position, const float *viewMatrix, uint32_t i)
+{
+    return -(viewMatrix[2] * position[0][i] + viewMatrix[6] * position[1][i] + viewMatrix[10] * position[2][i] +
+             viewMatrix[14]);
+}
+} // namespace
+
+SplatSorter::SplatSorter(ThreadPool &pool) : m_pool(pool), m_radixSorter(pool)
+{
+}
+
+void SplatSorter::ComputeDepths(const float *const *position, const float *viewMatrix, const uint32_t *indices,
+                                size_t indexCount)
+{
+    // 按高斯原始下标顺序访存计算深度并统计范围；沿用排列时只需再按排列读取这一个数组
+    std::vector<float> minDepth(m_pool.GetThreadCount(), std::numeric_limits<float>::max());
+    std::vector<float> maxDepth(m_pool.GetThreadCount(), std::numeric_limits<float>::lowest());
+    m_pool.ParallelFor(0, indexCount, KEY_GRAIN_SIZE, [&](size_t begin, size_t end, unsigned int worker) {
+        float localMin = minDepth[worker], localMax = maxDepth[worker];
+        for (size_t j = begin; j < end; ++j)
+        {
+            const uint32_t i = indices ? indices[j] : static_cast<uint32_t>(j);
+            const float depth = ViewDepth(position, viewMatrix, i);
+            m_depths[i] = depth;
+            localMin = std::min(localMin, depth);
+            localMax = std::max(localMax, depth);
+        }
+        minDepth[worker] = localMin;
+        maxDepth[worker] = localMax;
+    });
+    m_minDepth = *std::min_element(minDepth.begin(), minDepth.end());
+    const float range = *std::max_element(maxDepth.begin(), maxDepth.end()) - m_minDepth;
+    const float maxKey = static_cast<float>((1ull << m_keyBits) - 1);
+    m_depthScale = range > 0.0f ? maxKey / range : 0.0f;
+}
+
+uint32_t SplatSorter::DepthKey(float depth) const
+{
+    if (m_keyBits >= 32)
+        return RadixSorter::DepthToBackToFrontKey(depth);
+
+    // 深度越大键越小；截断到 [0, maxKey] 防止浮点误差越界
+    const uint32_t maxKey = (1u << m_keyBits) - 1;
+    const float q = std::min((depth - m_minDepth) * m_depthScale, static_cast<float>(maxKey));
+    return maxKey - static_cast<uint32_t>(std::max(q, 0.0f));
+}
+
+bool SplatSorter::RemapOrder(const uint32_t *indices, size_t indexCount)
+{
+    // 1. 标记本帧参与排序的高斯
+    const size_t count = m_depths.size();
+    m_marks.assign(count, indices ? 0 : 1);
+    if (indices)
+    {
+        m_pool.ParallelFor(0, indexCount, KEY_GRAIN_SIZE, [&](size_t begin, size_t end, unsigned int) {
+            for (size_t j = begin; j < end; ++j)
+                m_marks[indices[j]] = 1;
+        });
+    }
+
+    // 2. 按上一帧排列的顺序保留仍可见的高斯，并标记为已保留
+    m_scratchOrder.resize(indexCount);
+    const size_t kept = m_pool.ParallelCompact(
+        m_order.size(), KEY_GRAIN_SIZE, [&](size_t j) { return m_marks[m_order[j]] != 0; },
+        [&](size_t j, size_t k) {
+            m_scratchOrder[k] = m_order[j];
+            m_marks[m_order[j]] = 2;
+        });
+
+    // 新进入的高斯过多时整体重排更划算
+    const size_t entered = indexCount - kept;
+    if (static_cast<float>(entered) > m_disorderThreshold * static_cast<float>(indexCount))
+        return false;
+
+    // 3. 新进入的高斯追加在末尾，稍后单独排序
+    m_pool.ParallelCompact(
+        indexCount, KEY_GRAIN_SIZE,
+        [&](size_t j) { return m_marks[indices ? indices[j] : j] == 1; },
+        [&](size_t j, size_t k) { m_scratchOrder[kept + k] = indices ? indices[j] : static_cast<uint32_t>(j); });
+
+    m_order.swap(m_scratchOrder);
+    m_tailBegin = kept;
+    return true;
+}
+
+void SplatSorter::ComputeKeys(bool identityOrder, const uint32_t *indices)
+{
+    const size_t count = m_keys.size();
+    m_pool.ParallelFor(0, count, KEY_GRAIN_SIZE, [&](size_t begin, size_t end, unsigned int) {
+        for (size_t j = begin; j < end; ++j)
+        {
+            if (identityOrder)
+                m_order[j] = indices ? indices[j] : static_cast<uint32_t>(j);
+            m_keys[j] = DepthKey(m_depths[m_order[j]]);
+        }
+    });
+}
+
+bool SplatSorter::SortBlocksAdaptive()
+{
+    // 沿用部分按线程数切块；新进入可见集合的高斯（若有）单独作为最后一块
+    const size_t count = m_keys.size();
+    const size_t head = std::min(m_tailBegin, count);
+    const size_t headBlocks =
+        head == 0 ? 0 : std::max<size_t>(1, std::min<size_t>(m_pool.GetThreadCount(), head / MIN_SORT_BLOCK));
+    const size_t blockSize = headBlocks > 0 ? (head + headBlocks - 1) / headBlocks : 0;
+    m_blockBounds.clear();
+    for (size_t b = 0; b < headBlocks; ++b)
+        m_blockBounds.push_back(std::min(b * blockSize, head));
+    if (head < count)
+        m_blockBounds.push_back(head);
+    m_blockBounds.push_back(count);
+    const size_t blockCount = m_blockBounds.size() - 1;
+
+    std::atomic<bool> overBudget{false};
+    m_pool.ParallelFor(0, blockCount, 1, [&](size_t blockBegin, size_t blockEnd, unsigned int) {
+        for (size_t block = blockBegin; block < blockEnd; ++block)
+        {
+            const size_t begin = m_blockBounds[block];
+            const size_t end = m_blockBounds[block + 1];
+            if (begin >= head)
+            {
+                SortTail(begin, end);
+                continue;
+            }
+            size_t budget = (end - begin) * INSERTION_MOVE_BUDGET;
+            uint32_t *keys = m_keys.data();
+            uint32_t *order = m_order.data();
+
+            // 插入排序：近似有序时接近线性
+            for (size_t i = begin + 1; i < end; ++i)
+            {
+                const uint32_t key = keys[i];
+                if (keys[i - 1] <= key)
+                    continue;
+                const uint32_t value = order[i];
+                size_t j = i;
+                while (j > begin && keys[j - 1] > key)
+                {
+                    keys[j] = keys[j - 1];
+                    order[j] = order[j - 1];
+                    --j;
+                }
+                keys[j] = key;
+                order[j] = value;
+
+                const size_t moves = i - j;
+                if (moves > budget || overBudget.load(std::memory_order_relaxed))
+                {
+                    overBudget.store(true, std::memory_order_relaxed);
+                    return;
+                }
+                budget -= moves;
+            }
+        }
+    });
+    return !overBudget.load();
+}
+
+void SplatSorter::SortTail(size_t begin, size_t end)
+{
+    // 新进入的高斯通常很少且顺序任意，键与下标打包后直接比较排序
+    // 只有最后一块是新进入的高斯，由单个任务处理，可直接复用成员缓冲
+    std::vector<uint64_t> &packed = m_tailScratch;
+    packed.resize(end - begin);
+    for (size_t j = begin; j < end; ++j)
+        packed[j - begin] = (static_cast<uint64_t>(m_keys[j]) << 32) | m_order[j];
+    std::sort(packed.begin(), packed.end());
+    for (size_t j = begin; j < end; ++j)
+    {
+        m_keys[j] = static_cast<uint32_t>(packed[j - begin] >> 32);
+        m_order[j] = static_cast<uint32_t>(packed[j - begin]);
+    }
+}
+
+void SplatSorter::MergeBlocks()
+{
+    const size_t count = m_keys.size();
+    m_scratchKeys.resize(count);
+    m_scratchOrder.resize(count);
+
+    // 逐轮两两归并相邻有序段，共 log2(块数) 轮
+    while (m_blockBounds.size() > 2)
+    {
+        const size_t runCount = m_blockBounds.size() - 1;
+        const size_t pairCount = (runCount + 1) / 2;
+
+        m_pool.ParallelFor(0, pairCount, 1, [&](size_t pairBegin, size_t pairEnd, unsigned int) {
+            for (size_t pair = pairBegin; pair < pairEnd; ++pair)
+            {
+                const size_t begin = m_blockBounds[pair * 2];
+                const size_t mid = m_blockBounds[std::min(pair * 2 + 1, runCount)];
+                const size_t end = m_blockBounds[std::min(pair * 2 + 2, runCount)];
+                size_t a = begin, b = mid, out = begin;
+                while (a < mid && b < end)
+                {
+                    const bool takeB = m_keys[b] < m_keys[a];
+                    const size_t src = takeB ? b++ : a++;
+                    m_scratchKeys[out] = m_keys[src];
+                    m_scratchOrder[out] = m_order[src];
+                    ++out;
+                }
+                for (; a < mid; ++a, ++out)
+                {
+                    m_scratchKeys[out] = m_keys[a];
+                    m_scratchOrder[out] = m_order[a];
+                }
+                for (; b < end; ++b, ++out)
+                {
+                    m_scratchKeys[out] = m_keys[b];
+                    m_scratchOrder[out] = m_order[b];
+                }
+            }
+        });
+
+        m_keys.swap(m_scratchKeys);
+        m_order.swap(m_scratchOrder);
+
+        std::vector<size_t> merged;
+        merged.reserve(pairCount + 1);
+        for (size_t run = 0; run < runCount; run += 2)
+            merged.push_back(m_blockBounds[run]);
+        merged.push_back(count);
+        m_blockBounds.swap(merged);
+    }
+}
+
+bool SplatSorter::ShouldTryIncremental(const float *viewMatrix)
+{
+    // 深度 = -(d · p + t)：平移只改变 t，所有高斯的深度整体平移，顺序只取决于视线方向 d。
+    // d 变化 Δ 时深度的相对变化约为 |Δ| · 场景尺度，与量化区间（深度范围 / 2^位数）相比即可判断顺序是否基本不变
+    const float dir[3] = {viewMatrix[2], viewMatrix[6], viewMatrix[10]};
+    float delta = 0.0f;
+    for (int c = 0; c < 3; ++c)
+    {
+        delta += (dir[c] - m_lastViewDir[c]) * (dir[c] - m_lastViewDir[c]);
+        m_lastViewDir[c] = dir[c];
+    }
+    if (m_fallbackStreak < FALLBACK_BACKOFF_FRAMES)
+        return true;
+    const float keySteps = static_cast<float>(1u << std::min(m_keyBits, 16));
+    const float stillLimit = STILL_KEY_STEPS / keySteps;
+    return delta <= stillLimit * stillLimit;
+}
+
+void SplatSorter::Sort(const float *const *position, size_t count, const float *viewMatrix)
+{
+    Sort(position, count, viewMatrix, nullptr, count);
+}
+
+void SplatSorter::Sort(const float *const *position, size_t count, const float *viewMatrix, const uint32_t *indices,
+                       size_t indexCount)
+{
+    auto start = std::chrono::steady_clock::now();
+    if (!indices)
+        indexCount = count;
+    bool reuseOrder = m_mode == Mode::Incremental && m_orderTotal == count && !m_order.empty();
+
+    m_stats.fullSort = true;
+    m_stats.skipped = false;
+    m_stats.disorder = 0.0f;
+    if (m_mode == Mode::Incremental && !ShouldTryIncremental(viewMatrix))
+    {
+        reuseOrder = false;
+        m_stats.skipped = true;
+    }
+    m_depths.resize(count);
+    m_keys.resize(indexCount);
+    m_tailBegin = indexCount;
+    m_orderTotal = count;
+    if (indexCount == 0)
+    {
+        m_order.clear();
+        m_stats.milliseconds = 0.0;
+        return;
+    }
+    ComputeDepths(position, viewMatrix, indices, indexCount);
+
+    // 可见集合可能变化：把上一帧排列映射到本帧集合上
+    if (reuseOrder && (indices || m_order.size() != indexCount))
+        reuseOrder = RemapOrder(indices, indexCount);
+
+    const bool attempted = reuseOrder;
+    bool keysComputed = false;
+    if (reuseOrder)
+    {
+        // 在上一帧排列上等间隔抽样相邻对估计无序度，避免在大幅变化时白白付出按排列访存的代价
+        const size_t head = m_tailBegin;
+        const size_t samples = head > 1 ? std::min(DISORDER_SAMPLE_COUNT, head - 1) : 0;
+        const size_t stride = samples > 0 ? (head - 1) / samples : 0;
+        size_t descents = 0;
+        for (size_t s = 0; s < samples; ++s)
+        {
+            const size_t j = s * stride;
+            descents += DepthKey(m_depths[m_order[j + 1]]) < DepthKey(m_depths[m_order[j]]);
+        }
+        m_stats.disorder = samples > 0 ? static_cast<float>(descents) / static_cast<float>(samples) : 0.0f;
+
+        if (m_stats.disorder <= m_disorderThreshold)
+        {
+            ComputeKeys(false, indices);
+            keysComputed = true;
+            if (SortBlocksAdaptive())
+            {
+                MergeBlocks();
+                m_stats.fullSort = false;
+            }
+        }
+    }
+
+    // 插入排序中途放弃时键与排列仍一一对应，直接对其做完整排序即可
+    if (m_stats.fullSort)
+    {
+        if (!keysComputed)
+        {
+            m_order.resize(indexCount);
+            ComputeKeys(true, indices);
+        }
+        m_radixSorter.Sort(m_keys.data(), m_order.data(), indexCount);
+    }
+    m_tailBegin = indexCount;
+    // 只统计尝试沿用排列后退回的帧；退避中跳过的帧保持计数
+    if (!m_stats.fullSort)
+        m_fallbackStreak = 0;
+    else if (attempted)
+        ++m_fallbackStreak;
+
+    m_stats.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+RENDERER_NAMESPACE_END
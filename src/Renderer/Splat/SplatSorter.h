@@ -0,0 +1,132 @@
+#pragma once
+
+#include "Core/RenderCore.h"
+#include "Core/ThreadPool.h"
+#include "Splat/RadixSort.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+RENDERER_NAMESPACE_BEGIN
+
+/// 高斯从后往前的绘制顺序排序器
+///
+/// Incremental 模式利用帧间相关性：相机小幅移动时上一帧的顺序几乎仍然有序，
+/// 因此沿用上一帧的排列重新计算深度键，按块做自适应插入排序后归并各块有序段；
+/// 若测得的无序度（相邻逆序对比例）超过阈值，或插入排序的移动量超出预算，则退回完整基数排序。
+/// 连续退回数帧后（持续环绕等较大幅度的运动）不再尝试沿用排列，也不抽样无序度，直接完整排序，
+/// 直到视线方向的帧间变化小到只会移动约几个量化区间（平移只整体平移深度，不影响顺序）。
+/// 深度键默认按当帧深度范围量化为 16 位：同一量化区间内的高斯保持上一帧的相对顺序，
+/// 既让帧间顺序更稳定，也使完整基数排序只需 2 趟。
+class RENDERER_API SplatSorter
+{
+public:
+    enum class Mode
+    {
+        Full = 0,    // 每帧完整基数排序
+        Incremental, // 沿用上一帧排列，必要时退回完整排序
+    };
+
+    /// 最近一次排序的统计
+    struct Stats
+    {
+        bool fullSort = true;   // 是否执行了完整基数排序
+        bool skipped = false;   // 处于退避状态，未尝试沿用排列
+        float disorder = 0.0f;  // 沿用排列时相邻逆序对的比例
+        double milliseconds = 0.0;
+    };
+
+    explicit SplatSorter(ThreadPool &pool = ThreadPool::Global());
+
+    SplatSorter(const SplatSorter &) = delete;
+    SplatSorter &operator=(const SplatSorter &) = delete;
+
+    /// 按视空间深度从远到近排序
+    /// @param position   x, y, z 三个平面
+    /// @param viewMatrix 列主序视图矩阵（相机看向 -Z）
+    void Sort(const float *const *position, size_t count, const float *viewMatrix);
+    /// 只对 indices 列出的高斯排序（如 SplatCuller 的可见列表），GetOrder() 中为原始下标
+    /// 可见集合变化时沿用上一帧排列中仍可见的部分，新进入的高斯单独排序后作为一个有序段参与归并
+    /// @param count 高斯总数（position 平面长度）
+    void Sort(const float *const *position, size_t count, const float *viewMatrix, const uint32_t *indices,
+              size_t indexCount);
+
+    /// 排序结果：绘制顺序中的第 i 个高斯下标（长度为参与排序的高斯数）
+    const std::vector<uint32_t> &GetOrder() const
+    {
+        return m_order;
+    }
+    const Stats &GetStats() const
+    {
+        return m_stats;
+    }
+
+    void SetMode(Mode mode)
+    {
+        m_mode = mode;
+    }
+    Mode GetMode() const
+    {
+        return m_mode;
+    }
+    /// 无序度阈值（相邻逆序对比例，随机顺序约为 0.5），超过即退回完整排序
+    void SetDisorderThreshold(float threshold)
+    {
+        m_disorderThreshold = threshold;
+    }
+    float GetDisorderThreshold() const
+    {
+        return m_disorderThreshold;
+    }
+    /// 深度键位数 [8, 32]；32 表示直接使用浮点深度的全精度键
+    void SetKeyBits(int bits)
+    {
+        m_keyBits = bits < 8 ? 8 : (bits > 32 ? 32 : bits);
+    }
+    int GetKeyBits() const
+    {
+        return m_keyBits;
+    }
+    /// 丢弃历史排列，下一次排序必定为完整排序
+    void Reset()
+    {
+        m_order.clear();
+        m_orderTotal = 0;
+        m_fallbackStreak = 0;
+    }
+
+private:
+    void ComputeDepths(const float *const *position, const float *viewMatrix, const uint32_t *indices,
+                       size_t indexCount);
+    uint32_t DepthKey(float depth) const;
+    bool RemapOrder(const uint32_t *indices, size_t indexCount);
+    void ComputeKeys(bool identityOrder, const uint32_t *indices);
+    bool SortBlocksAdaptive();
+    void SortTail(size_t begin, size_t end);
+    bool ShouldTryIncremental(const float *viewMatrix);
+    void MergeBlocks();
+
+    ThreadPool &m_pool;
+    RadixSorter m_radixSorter;
+    Mode m_mode = Mode::Incremental;
+    float m_disorderThreshold = 0.25f;
+    int m_keyBits = 16;
+    float m_minDepth = 0.0f;
+    float m_depthScale = 0.0f;
+    Stats m_stats;
+    int m_fallbackStreak = 0;                   // 连续尝试沿用排列却退回完整排序的帧数
+    float m_lastViewDir[3] = {0.0f, 0.0f, 0.0f}; // 上一帧视图矩阵的第 3 行（视线方向）
+
+    std::vector<float> m_depths; // 按高斯下标存放的视空间深度（只有参与排序的高斯有效）
+    std::vector<uint32_t> m_order;
+    size_t m_orderTotal = 0;      // m_order 对应的高斯总数，变化时不能沿用排列
+    size_t m_tailBegin = 0;       // m_order 中 [m_tailBegin, end) 为新进入可见集合的高斯，单独排序
+    std::vector<uint8_t> m_marks; // 可见集合变化时的标记：1 = 本帧可见，2 = 且在上一帧排列中
+    std::vector<uint32_t> m_keys;
+    std::vector<uint32_t> m_scratchKeys;
+    std::vector<uint32_t> m_scratchOrder;
+    std::vector<uint64_t> m_tailScratch; // SortTail 的键 + 下标打包数组
+    std::vector<size_t> m_blockBounds; // 各有序段的起点，末尾为 count
+};
+
+RENDERER_NAMESPACE_END
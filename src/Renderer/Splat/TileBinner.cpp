@@ -0,0 +1,133 @@
+#include "Splat/TileBinner.h"
+#include <algorithm>
+#include <cmath>
+
+RENDERER_NAMESPACE_BEGIN
+
+namespace
+{
+// 前缀和与复制阶段每块处理的高斯数
+const size_t BIN_GRAIN_SIZE = 16384;
+const size_t RANGE_GRAIN_SIZE = 65536;
+
+// 像素坐标 -> 分块坐标，截断到 [0, limit]；NaN 视为 0
+inline uint32_t ToTileCoord(float tile, int limit)
+{
+    if (!(tile > 0.0f))
+        return 0;
+    return static_cast<uint32_t>(std::min(tile, static_cast<float>(limit)));
+}
+} // namespace
+
+TileBinner::TileBinner(ThreadPool &pool) : m_pool(pool), m_sorter(pool)
+{
+}
+
+void TileBinner::Bin(const float *const *mean2D, const float *radius, const float *depth, size_t count, int width,
+                     int height)
+{
+    m_tilesX = (std::max(width, 0) + TILE_SIZE - 1) / TILE_SIZE;
+    m_tilesY = (std::max(height, 0) + TILE_SIZE - 1) / TILE_SIZE;
+    const size_t tileCount = static_cast<size_t>(m_tilesX) * m_tilesY;
+    m_ranges.assign(tileCount, TileRange());
+    m_instanceCount = 0;
+    m_keys.clear();
+    m_values.clear();
+    if (count == 0 || tileCount == 0)
+        return;
+
+    // 1. 每个高斯覆盖的分块矩形与实例数，按块累计
+    const size_t blockCount = (count + BIN_GRAIN_SIZE - 1) / BIN_GRAIN_SIZE;
+    m_rects.resize(count * 4);
+    m_offsets.resize(count);
+    m_blockSums.assign(blockCount, 0);
+    const float invTile = 1.0f / static_cast<float>(TILE_SIZE);
+
+    m_pool.ParallelFor(0, blockCount, 1, [&](size_t blockBegin, size_t blockEnd, unsigned int) {
+        for (size_t block = blockBegin; block < blockEnd; ++block)
+        {
+            const size_t end = std::min(count, (block + 1) * BIN_GRAIN_SIZE);
+            size_t blockSum = 0;
+            for (size_t i = block * BIN_GRAIN_SIZE; i < end; ++i)
+            {
+                uint32_t *rect = &m_rects[i * 4];
+                const float r = radius[i];
+                if (!(r > 0.0f))
+                {
+                    rect[0] = rect[1] = rect[2] = rect[3] = 0;
+                    m_offsets[i] = 0;
+                    continue;
+                }
+                const float x = mean2D[0][i], y = mean2D[1][i];
+                rect[0] = ToTileCoord(std::floor((x - r) * invTile), m_tilesX);
+                rect[1] = ToTileCoord(std::floor((y - r) * invTile), m_tilesY);
+                rect[2] = ToTileCoord(std::ceil((x + r) * invTile), m_tilesX);
+                rect[3] = ToTileCoord(std::ceil((y + r) * invTile), m_tilesY);
+                const size_t touched = static_cast<size_t>(rect[2] - rect[0]) * (rect[3] - rect[1]);
+                m_offsets[i] = touched;
+                blockSum += touched;
+            }
+            m_blockSums[block] = blockSum;
+        }
+    });
+
+    // 2. 块间排他前缀和
+    size_t total = 0;
+    for (size_t &blockSum : m_blockSums)
+    {
+        const size_t sum = blockSum;
+        blockSum = total;
+        total += sum;
+    }
+    m_instanceCount = total;
+    if (total == 0)
+        return;
+    m_keys.resize(total);
+    m_values.resize(total);
+
+    // 3. 块内前缀和并复制实例：键 = tileID << 32 | depth（深度为正，升序即从近到远）
+    m_pool.ParallelFor(0, blockCount, 1, [&](size_t blockBegin, size_t blockEnd, unsigned int) {
+        for (size_t block = blockBegin; block < blockEnd; ++block)
+        {
+            const size_t end = std::min(count, (block + 1) * BIN_GRAIN_SIZE);
+            size_t cursor = m_blockSums[block];
+            for (size_t i = block * BIN_GRAIN_SIZE; i < end; ++i)
+            {
+                if (m_offsets[i] == 0)
+                    continue;
+                const uint32_t *rect = &m_rects[i * 4];
+                const uint64_t depthKey = RadixSorter::FloatToKey(depth[i]);
+                for (uint32_t ty = rect[1]; ty < rect[3]; ++ty)
+                {
+                    for (uint32_t tx = rect[0]; tx < rect[2]; ++tx)
+                    {
+                        const uint64_t tile = static_cast<uint64_t>(ty) * m_tilesX + tx;
+                        m_keys[cursor] = (tile << 32) | depthKey;
+                        m_values[cursor] = static_cast<uint32_t>(i);
+                        ++cursor;
+                    }
+                }
+            }
+        }
+    });
+
+    // 4. 只排序深度 32 位 + 分块号所需的位数
+    int tileBits = 0;
+    while ((static_cast<size_t>(1) << tileBits) < tileCount)
+        ++tileBits;
+    m_sorter.Sort(m_keys.data(), m_values.data(), total, 32 + tileBits);
+
+    // 5. 分块号变化处即区间边界
+    m_pool.ParallelFor(0, total, RANGE_GRAIN_SIZE, [&](size_t begin, size_t end, unsigned int) {
+        for (size_t i = begin; i < end; ++i)
+        {
+            const uint32_t tile = static_cast<uint32_t>(m_keys[i] >> 32);
+            if (i == 0 || static_cast<uint32_t>(m_keys[i - 1] >> 32) != tile)
+                m_ranges[tile].begin = static_cast<uint32_t>(i);
+            if (i + 1 == total || static_cast<uint32_t>(m_keys[i + 1] >> 32) != tile)
+                m_ranges[tile].end = static_cast<uint32_t>(i + 1);
+        }
+    });
+}
+
+RENDERER_NAMESPACE_END
@@ -0,0 +1,81 @@
+#pragma once
+
+#include "Core/RenderCore.h"
+#include "Core/ThreadPool.h"
+#include "Splat/RadixSort.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+RENDERER_NAMESPACE_BEGIN
+
+/// 屏幕分块的高斯实例区间：GetSplatList() 中 [begin, end) 为覆盖该块的高斯，按深度从近到远
+struct TileRange
+{
+    uint32_t begin = 0;
+    uint32_t end = 0;
+};
+
+/// 3DGS 参考实现的分块预处理（CPU 版）
+///
+/// 1. 由投影后的屏幕中心与 3σ 半径求出每个高斯覆盖的 16x16 分块矩形
+/// 2. 前缀和得到每个高斯的实例写入位置，为每个覆盖的分块复制一个实例，键为 tileID << 32 | depth
+/// 3. 64 位键基数排序（只排序有效位），得到按分块、再按深度从近到远的实例序列
+/// 4. 扫描相邻实例的分块号得到每个分块的 [begin, end) 区间
+///
+/// 屏幕坐标原点在左下角（与 CovarianceProjector 一致，y 轴向上），分块号 = tileY * tilesX + tileX。
+class RENDERER_API TileBinner
+{
+public:
+    static constexpr int TILE_SIZE = 16;
+
+    explicit TileBinner(ThreadPool &pool = ThreadPool::Global());
+
+    TileBinner(const TileBinner &) = delete;
+    TileBinner &operator=(const TileBinner &) = delete;
+
+    /// @param mean2D 屏幕中心（像素）x, y 两个平面
+    /// @param radius 3σ 屏幕半径（像素），0 表示不可见
+    /// @param depth  视空间深度（相机前方为正）
+    void Bin(const float *const *mean2D, const float *radius, const float *depth, size_t count, int width,
+             int height);
+
+    int GetTilesX() const
+    {
+        return m_tilesX;
+    }
+    int GetTilesY() const
+    {
+        return m_tilesY;
+    }
+    /// 每个分块的实例区间，长度为 tilesX * tilesY
+    const std::vector<TileRange> &GetTileRanges() const
+    {
+        return m_ranges;
+    }
+    /// 排序后的实例对应的高斯下标
+    const std::vector<uint32_t> &GetSplatList() const
+    {
+        return m_values;
+    }
+    size_t GetInstanceCount() const
+    {
+        return m_instanceCount;
+    }
+
+private:
+    ThreadPool &m_pool;
+    RadixSorter m_sorter;
+    int m_tilesX = 0;
+    int m_tilesY = 0;
+    size_t m_instanceCount = 0;
+
+    std::vector<uint32_t> m_rects;   // 每个高斯覆盖的分块矩形 minX, minY, maxX, maxY（左闭右开）
+    std::vector<size_t> m_offsets;   // 每个高斯实例的写入起点（排他前缀和）
+    std::vector<size_t> m_blockSums; // 并行前缀和的块内总数
+    std::vector<uint64_t> m_keys;
+    std::vector<uint32_t> m_values;
+    std::vector<TileRange> m_ranges;
+};
+
+RENDERER_NAMESPACE_END
@@ -0,0 +1,761 @@
+#include "SplatPass.h"
+#include "RenderContext.h"
+#include "ShaderManager.h"
+#include "RenderHelper/RenderHelper.h"
+#include "Logger/Log.h"
+#include <glad/glad.h>
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+RENDERER_NAMESPACE_BEGIN
+
+namespace
+{
+// SSBO 绑定点，与 splat_common.glsl / splat.vs.glsl 一致
+const GLuint CLOUD_BINDING = 0;
+const GLuint ORDER_BINDING = 1;
+const GLuint PREPROCESSED_BINDING = 2;
+const GLuint DRAW_COMMAND_BINDING = 4;
+const float SPLAT_NEAR_CLIP = 0.01f;
+
+GLuint CreateCloudBuffer(size_t size)
+{
+    GLint64 maxBlockSize = 0;
+    glGetInteger64v(GL_MAX_SHADER_STORAGE_BLOCK_SIZE, &maxBlockSize);
+    if (static_cast<GLint64>(size) > maxBlockSize)
+    {
+        LOG_CORE_WARN("SplatPass: cloud storage ({} bytes) exceeds GL_MAX_SHADER_STORAGE_BLOCK_SIZE ({} bytes)", size,
+                      maxBlockSize);
+    }
+
+    GLuint buffer = 0;
+    glGenBuffers(1, &buffer);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, buffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, static_cast<GLsizeiptr>(size), nullptr, GL_STATIC_DRAW);
+    return buffer;
+}
+} // namespace
+
+SplatPass::SplatPass(ShaderManager &shaderManager, const RenderPipelineConfig &config)
+    : m_shaderManager(shaderManager), m_config(config), m_pointPreview(config.splatPointPreview),
+      m_blendMode(config.splatBlendMode)
+{
+    SplatCullParams cullParams;
+    cullParams.guardBand = config.splatCullGuardBand;
+    cullParams.minOpacity = config.splatCullMinOpacity;
+    cullParams.minRadius = config.splatCullMinRadius;
+    cullParams.nearClip = SPLAT_NEAR_CLIP;
+    m_culler.SetParams(cullParams);
+
+    m_shader = shaderManager.LoadShader("splat", "res/shaders/splat.vs.glsl", "res/shaders/splat.fs.glsl");
+    if (!m_shader)
+    {
+        throw std::runtime_error("SplatPass initialization failed: splat shader load failed");
+    }
+    m_oitShader = shaderManager.LoadShader("splat_oit", "res/shaders/splat.vs.glsl", "res/shaders/splat_oit.fs.glsl");
+    if (!m_oitShader)
+    {
+        throw std::runtime_error("SplatPass initialization failed: splat OIT shader load failed");
+    }
+    m_pointShader = shaderManager.LoadShader("splat_point", "res/shaders/point.vs.glsl", "res/shaders/point.fs.glsl");
+    if (!m_pointShader)
+    {
+        throw std::runtime_error("SplatPass initialization failed: point shader load failed");
+    }
+    if (config.splatDepthPrepass)
+    {
+        m_depthShader =
+            shaderManager.LoadShader("splat_depth", "res/shaders/splat.vs.glsl", "res/shaders/splat_depth.fs.glsl");
+        if (!m_depthShader)
+        {
+            throw std::runtime_error("SplatPass initialization failed: splat depth shader load failed");
+        }
+    }
+
+    // 面片顶点由 gl_VertexID 生成，core profile 下仍需绑定一个空 VAO
+    glGenVertexArrays(1, &m_vao);
+}
+
+SplatPass::~SplatPass()
+{
+    // 先停止后台排序，它持有点云位置数组的裸指针
+    m_asyncSorter.reset();
+    ReleaseBuffers();
+    m_frameBuffer.Detach(FrameBuffer::Attachment::Color0);
+    m_frameBuffer.Detach(FrameBuffer::Attachment::Depth);
+    m_oitFrameBuffer.Detach(FrameBuffer::Attachment::Depth);
+    ReleaseOITTargets();
+    if (m_vao != 0)
+        glDeleteVertexArrays(1, &m_vao);
+    if (m_depthTexture != 0)
+        glDeleteTextures(1, &m_depthTexture);
+}
+
+void SplatPass::ReleaseBuffers()
+{
+    if (m_cloudBuffer != 0)
+        glDeleteBuffers(1, &m_cloudBuffer);
+    if (m_orderBuffer != 0)
+        glDeleteBuffers(1, &m_orderBuffer);
+    m_cloudBuffer = 0;
+    m_orderBuffer = 0;
+    m_drawCount = 0;
+    m_layout = CloudLayout();
+}
+
+void SplatPass::UploadCloud(const GaussianCloud &cloud)
+{
+    m_layout.count = static_cast<unsigned int>(cloud.GetCount());
+    m_layout.shDegree = cloud.GetSHDegree();
+    for (int a = 0; a < static_cast<int>(GaussianCloud::Attribute::Count); ++a)
+        m_layout.offsets[a] =
+            static_cast<unsigned int>(cloud.GetAttributeOffset(static_cast<GaussianCloud::Attribute>(a)) / sizeof(float));
+
+    m_cloudBuffer = CreateCloudBuffer(cloud.GetStorageSize());
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, static_cast<GLsizeiptr>(cloud.GetStorageSize()), cloud.GetStorage());
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+}
+
+void SplatPass::UploadLod(const GaussianCloud &cloud)
+{
+    // 叶子（原点云）与内部节点（节点点云）按属性平面拼接：每个分量平面先写叶子，再写内部节点
+    const GaussianCloud &nodes = *m_lodTree.GetNodeCloud();
+    const size_t leafCount = cloud.GetCount();
+    const size_t nodeCount = nodes.GetCount();
+    const size_t count = leafCount + nodeCount;
+    const int shDegree = cloud.GetSHDegree();
+    size_t offsets[static_cast<int>(GaussianCloud::Attribute::Count)];
+    const size_t storageSize = GaussianCloud::GetLayout(count, shDegree, offsets);
+
+    m_layout.count = static_cast<unsigned int>(count);
+    m_layout.shDegree = shDegree;
+    for (int a = 0; a < static_cast<int>(GaussianCloud::Attribute::Count); ++a)
+        m_layout.offsets[a] = static_cast<unsigned int>(offsets[a] / sizeof(float));
+
+    m_cloudBuffer = CreateCloudBuffer(storageSize);
+    for (int a = 0; a < static_cast<int>(GaussianCloud::Attribute::Count); ++a)
+    {
+        const GaussianCloud::Attribute attr = static_cast<GaussianCloud::Attribute>(a);
+        for (int c = 0; c < GaussianCloud::GetComponentCount(attr, shDegree); ++c)
+        {
+            const size_t plane = offsets[a] + static_cast<size_t>(c) * count * sizeof(float);
+            glBufferSubData(GL_SHADER_STORAGE_BUFFER, static_cast<GLintptr>(plane),
+                            static_cast<GLsizeiptr>(leafCount * sizeof(float)), cloud.GetComponent(attr, c));
+            if (nodeCount > 0)
+                glBufferSubData(GL_SHADER_STORAGE_BUFFER, static_cast<GLintptr>(plane + leafCount * sizeof(float)),
+                                static_cast<GLsizeiptr>(nodeCount * sizeof(float)), nodes.GetComponent(attr, c));
+        }
+    }
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+}
+
+size_t SplatPass::GetSortPositions(const float *position[3]) const
+{
+    if (!m_lodTree.IsEmpty())
+    {
+        for (int c = 0; c < 3; ++c)
+            position[c] = m_lodTree.GetPosition(c);
+        return m_lodTree.GetNodeCount();
+    }
+    for (int c = 0; c < 3; ++c)
+        position[c] = m_cloud->GetComponent(GaussianCloud::Attribute::Position, c);
+    return m_cloud->GetCount();
+}
+
+void SplatPass::UploadCompressed(const GaussianCloud &cloud, const std::shared_ptr<const SHCodebook> &shCodebook)
+{
+    CompressedGaussianCloud compressed;
+    const CompressedGaussianCloud::SHEncoding shEncoding = m_config.splatCompressedHalfSH
+                                                               ? CompressedGaussianCloud::SHEncoding::Float16
+                                                               : CompressedGaussianCloud::SHEncoding::UInt8;
+    compressed.Compress(cloud, shEncoding, shCodebook);
+
+    // 各段依次拼接：每个高斯 4 个字 | 块量化范围 | 球谐 | 高阶球谐码本
+    const std::shared_ptr<const SHCodebook> &codebook = compressed.GetSHCodebook();
+    const size_t splatBytes = compressed.GetSplatDataSize();
+    const size_t chunkBytes = compressed.GetChunkDataSize();
+    const size_t shBytes = compressed.GetSHDataSize();
+    const size_t codebookBytes = codebook ? codebook->GetEntryDataSize() : 0;
+    m_layout.count = static_cast<unsigned int>(compressed.GetCount());
+    m_layout.shDegree = compressed.GetSHDegree();
+    m_layout.compressed = true;
+    m_layout.chunkOffset = static_cast<unsigned int>(splatBytes / sizeof(uint32_t));
+    m_layout.shOffset = static_cast<unsigned int>((splatBytes + chunkBytes) / sizeof(uint32_t));
+    m_layout.shWordsPerSplat = compressed.GetSHWordsPerSplat();
+    m_layout.shEncoding = static_cast<int>(compressed.GetSHEncoding());
+    m_layout.shCodebookOffset = static_cast<unsigned int>((splatBytes + chunkBytes + shBytes) / sizeof(uint32_t));
+    m_layout.shCodebookDim = codebook ? codebook->GetDimension() : 0;
+
+    m_cloudBuffer = CreateCloudBuffer(splatBytes + chunkBytes + shBytes + codebookBytes);
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, static_cast<GLsizeiptr>(splatBytes), compressed.GetSplatData());
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, static_cast<GLintptr>(splatBytes), static_cast<GLsizeiptr>(chunkBytes),
+                    compressed.GetChunkData());
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, static_cast<GLintptr>(splatBytes + chunkBytes),
+                    static_cast<GLsizeiptr>(shBytes), compressed.GetSHData());
+    if (codebook)
+        glBufferSubData(GL_SHADER_STORAGE_BUFFER, static_cast<GLintptr>(splatBytes + chunkBytes + shBytes),
+                        static_cast<GLsizeiptr>(codebookBytes), codebook->GetEntryData());
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+    LOG_CORE_INFO("SplatPass: uploaded compressed cloud, {:.1f} MB -> {:.1f} MB",
+                  static_cast<double>(cloud.GetStorageSize()) / (1024.0 * 1024.0),
+                  static_cast<double>(compressed.GetMemorySize()) / (1024.0 * 1024.0));
+}
+
+void SplatPass::SetCloud(const std::shared_ptr<GaussianCloud> &cloud,
+                         const std::shared_ptr<const SHCodebook> &shCodebook)
+{
+    if (m_asyncSorter)
+        m_asyncSorter->SetPositions(nullptr, 0);
+    if (m_gpuSorter)
+        m_gpuSorter->SetPositions(nullptr, 0);
+    if (m_preprocessor)
+        m_preprocessor->Resize(0);
+    m_sorter.reset();
+    m_chunks.Clear();
+    m_lodTree.Clear();
+    m_orderVersion = 0;
+    ReleaseBuffers();
+    m_cloud = cloud;
+
+    if (!cloud || cloud->GetCount() == 0)
+        return;
+
+    // 后端优先级：GPU 排序（不少于 splatGpuSortThreshold）> LOD + CPU 排序（不少于 splatLodMinSplats）> CPU 排序。
+    // LOD 选择在 CPU 上进行，GPU 路径不构建 LOD；压缩上传按原始高斯量化，也不构建 LOD
+    const bool useGpu = cloud->GetCount() >= m_config.splatGpuSortThreshold;
+    const bool useLod = !useGpu && !m_config.splatCompressed && m_config.splatLod &&
+                        cloud->GetCount() >= m_config.splatLodMinSplats;
+    if (useLod)
+    {
+        m_lodTree.Build(*cloud);
+        LOG_CORE_INFO("SplatPass: built LOD tree, {} splats -> {} nodes", cloud->GetCount(),
+                      m_lodTree.GetNodeCount());
+        UploadLod(*cloud);
+    }
+    else if (m_config.splatCompressed)
+    {
+        UploadCompressed(*cloud, shCodebook);
+    }
+    else
+    {
+        UploadCloud(*cloud);
+    }
+
+    const float *position[3];
+    const size_t count = GetSortPositions(position);
+
+    if (useGpu)
+    {
+        m_backend = SortBackend::Gpu;
+        if (!m_gpuSorter)
+            m_gpuSorter = std::make_unique<GpuSplatSorter>(m_shaderManager);
+        if (m_config.splatGpuPreprocess)
+        {
+            // 深度键由预处理写出，排序器不需要位置
+            if (!m_preprocessor)
+                m_preprocessor = std::make_unique<GpuSplatPreprocessor>(m_shaderManager);
+            m_preprocessor->Resize(count);
+            m_gpuSorter->Resize(count);
+        }
+        else
+        {
+            m_gpuSorter->SetPositions(position, count);
+        }
+        return;
+    }
+
+    if (!useLod && m_config.splatCulling && m_config.splatChunkSize > 0)
+        m_chunks.Build(*cloud, m_config.splatChunkSize);
+
+    glGenBuffers(1, &m_orderBuffer);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_orderBuffer);
+    glBufferData(GL_SHADER_STORAGE_BUFFER, static_cast<GLsizeiptr>(count * sizeof(uint32_t)), nullptr,
+                 GL_DYNAMIC_DRAW);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+
+    if (m_config.splatAsyncSort)
+    {
+        m_backend = SortBackend::Async;
+        if (!m_asyncSorter)
+            m_asyncSorter = std::make_unique<AsyncSplatSorter>(m_config.splatSortThreads);
+        m_asyncSorter->SetPositions(position, count);
+    }
+    else
+    {
+        m_backend = SortBackend::Sync;
+        m_sorter = std::make_unique<SplatSorter>();
+    }
+}
+
+void SplatPass::UploadOrder(const uint32_t *order, size_t count)
+{
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, m_orderBuffer);
+    glBufferSubData(GL_SHADER_STORAGE_BUFFER, 0, static_cast<GLsizeiptr>(count * sizeof(uint32_t)), order);
+    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+    m_drawCount = count;
+}
+
+size_t SplatPass::Preprocess(const RenderContext &ctx)
+{
+    // 被剔除的高斯键为最大值，排序后位于末尾，索引缓冲的前 instanceCount 项即从后往前的可见高斯；
+    // OIT 模式不排序，直接按紧凑的可见列表绘制
+    const bool sorted = m_blendMode == SplatBlendMode::Sorted;
+    const Shader &shader = m_preprocessor->GetShader();
+    shader.use();
+    SetDrawUniforms(shader, ctx, 0);
+    shader.setFloat("u_minOpacity", m_config.splatCulling ? m_config.splatCullMinOpacity : 0.0f);
+    shader.setFloat("u_minRadius", m_config.splatCulling ? m_config.splatCullMinRadius : 0.0f);
+    if (sorted)
+    {
+        m_preprocessor->Run(m_cloudBuffer, m_gpuSorter->GetKeyBuffer(), m_gpuSorter->GetIndexBuffer());
+        m_gpuSorter->SortKeys();
+    }
+    else
+    {
+        m_preprocessor->Run(m_cloudBuffer);
+    }
+
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, ORDER_BINDING,
+                     sorted ? m_gpuSorter->GetIndexBuffer() : m_preprocessor->GetVisibleBuffer());
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, PREPROCESSED_BINDING, m_preprocessor->GetRecordBuffer());
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, DRAW_COMMAND_BINDING, m_preprocessor->GetCommandBuffer());
+    m_indirectDraw = true;
+    return m_preprocessor->GetCount();
+}
+
+size_t SplatPass::UpdateOrder(const RenderContext &ctx)
+{
+    m_identityOrder = false;
+    m_indirectDraw = false;
+    if (m_backend == SortBackend::Gpu && m_preprocessor && m_preprocessor->GetCount() > 0)
+        return Preprocess(ctx);
+
+    // CPU 排序前剔除不可见高斯；有 LOD 树时由节点选择同时完成剔除与合并
+    const uint32_t *visible = nullptr;
+    size_t visibleCount = 0;
+    const float focalX = ctx.projMatrix[0] * ctx.width * 0.5f;
+    const float focalY = ctx.projMatrix[5] * ctx.height * 0.5f;
+    if (!m_lodTree.IsEmpty())
+    {
+        // 关闭 splatCulling 时只保留视锥与近平面判定，与不剔除的 CPU 路径一样画出全部在视锥内的节点
+        SplatCullParams lodParams = m_culler.GetParams();
+        if (!m_config.splatCulling)
+        {
+            lodParams.minOpacity = 0.0f;
+            lodParams.minRadius = 0.0f;
+        }
+        visibleCount = m_lodTree.Select(ctx.viewMatrix, std::max(focalX, focalY), 1.0f / ctx.projMatrix[0],
+                                        1.0f / ctx.projMatrix[5], m_config.splatLodPixelError, lodParams);
+        visible = m_lodTree.GetSelection().data();
+        if (visibleCount == 0)
+            return 0;
+    }
+    else if (m_backend != SortBackend::Gpu && m_config.splatCulling)
+    {
+        m_culler.SetView(ctx.viewMatrix, focalX, focalY, 1.0f / ctx.projMatrix[0], 1.0f / ctx.projMatrix[5]);
+        visibleCount = m_culler.Cull(*m_cloud, &m_chunks);
+        visible = m_culler.GetVisibleIndices().data();
+    }
+
+    // 加权混合 OIT 与绘制顺序无关：可见列表不排序直接上传，没有剔除结果时按实例号绘制全部高斯
+    if (m_blendMode == SplatBlendMode::WeightedOIT)
+    {
+        const unsigned int orderBuffer = m_backend == SortBackend::Gpu ? m_gpuSorter->GetIndexBuffer() : m_orderBuffer;
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, ORDER_BINDING, orderBuffer);
+        if (!visible)
+        {
+            m_identityOrder = true;
+            return m_layout.count;
+        }
+        UploadOrder(visible, visibleCount);
+        return m_drawCount;
+    }
+
+    switch (m_backend)
+    {
+    case SortBackend::Gpu:
+        m_gpuSorter->Sort(ctx.viewMatrix);
+        glBindBufferBase(GL_SHADER_STORAGE_BUFFER, ORDER_BINDING, m_gpuSorter->GetIndexBuffer());
+        return m_gpuSorter->GetCount();
+    case SortBackend::Async:
+        m_asyncSorter->RequestSort(ctx.viewMatrix, visible, visibleCount);
+        // 首帧没有可用结果时等待一次，避免点云加载后空白一帧
+        if (m_orderVersion == 0)
+            m_asyncSorter->WaitIdle();
+        m_orderVersion = m_asyncSorter->ConsumeLatest(
+            m_orderVersion, [this](const uint32_t *order, size_t count) { UploadOrder(order, count); });
+        break;
+    case SortBackend::Sync:
+    {
+        const float *position[3];
+        const size_t count = GetSortPositions(position);
+        if (visible)
+            m_sorter->Sort(position, count, ctx.viewMatrix, visible, visibleCount);
+        else
+            m_sorter->Sort(position, count, ctx.viewMatrix);
+        const std::vector<uint32_t> &order = m_sorter->GetOrder();
+        UploadOrder(order.data(), order.size());
+        break;
+    }
+    }
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, ORDER_BINDING, m_orderBuffer);
+    return m_drawCount;
+}
+
+void SplatPass::EnsureDepthTexture(int width, int height)
+{
+    if (m_depthTexture != 0 && m_depthWidth == width && m_depthHeight == height)
+        return;
+    if (m_depthTexture != 0)
+        glDeleteTextures(1, &m_depthTexture);
+    // 与 GeometryPass 的深度纹理格式相同，才能用 glCopyImageSubData 直接复制
+    m_depthTexture = RenderHelper::CreateTexture2D(width, height, GL_DEPTH_COMPONENT, GL_DEPTH_COMPONENT, GL_FLOAT);
+    m_depthWidth = width;
+    m_depthHeight = height;
+}
+
+void SplatPass::EnsureOITTargets(int width, int height)
+{
+    if (m_accumTexture != 0 && m_oitWidth == width && m_oitHeight == height)
+        return;
+    ReleaseOITTargets();
+    // 累加目标用 32 位浮点：近处大量重叠的高斯权重可达 10³ 量级，16 位浮点容易溢出
+    m_accumTexture = RenderHelper::CreateTexture2D(width, height, GL_RGBA32F, GL_RGBA, GL_FLOAT);
+    m_revealageTexture = RenderHelper::CreateTexture2D(width, height, GL_R16F, GL_RED, GL_FLOAT);
+    m_oitFrameBuffer.Attach(FrameBuffer::Attachment::Color0, m_accumTexture);
+    m_oitFrameBuffer.Attach(FrameBuffer::Attachment::Color1, m_revealageTexture);
+    m_oitFrameBuffer.Bind();
+    const GLenum drawBuffers[] = {GL_COLOR_ATTACHMENT0, GL_COLOR_ATTACHMENT1};
+    glDrawBuffers(2, drawBuffers);
+    m_oitFrameBuffer.Unbind();
+    m_oitWidth = width;
+    m_oitHeight = height;
+}
+
+void SplatPass::ReleaseOITTargets()
+{
+    m_oitFrameBuffer.Detach(FrameBuffer::Attachment::Color0);
+    m_oitFrameBuffer.Detach(FrameBuffer::Attachment::Color1);
+    if (m_accumTexture != 0)
+        glDeleteTextures(1, &m_accumTexture);
+    if (m_revealageTexture != 0)
+        glDeleteTextures(1, &m_revealageTexture);
+    m_accumTexture = 0;
+    m_revealageTexture = 0;
+}
+
+void SplatPass::SetBlendMode(SplatBlendMode mode)
+{
+    if (mode == m_blendMode)
+        return;
+    m_blendMode = mode;
+    // 索引缓冲在 OIT 模式下被未排序的可见列表覆盖，切回排序时重新等待一次完整结果
+    m_orderVersion = 0;
+    LOG_CORE_INFO("SplatPass: blend mode -> {}", mode == SplatBlendMode::Sorted ? "sorted" : "weighted OIT");
+}
+
+void SplatPass::SetPointPreview(bool enabled)
+{
+    m_pointPreview = enabled;
+}
+
+void SplatPass::RequestCapture()
+{
+    m_captureRequested = true;
+}
+
+bool SplatPass::TakeCapture(SplatImage &image)
+{
+    if (!m_captureReady)
+        return false;
+    image = std::move(m_capture);
+    m_capture = SplatImage();
+    m_captureReady = false;
+    return true;
+}
+
+void SplatPass::Capture(const RenderContext &ctx, size_t instanceCount)
+{
+    m_captureRequested = false;
+
+    // 临时目标只用这一次；不接深度附件，与 SplatRasterizer 一样不受场景几何遮挡
+    unsigned int texture = RenderHelper::CreateTexture2D(ctx.width, ctx.height, GL_RGBA32F, GL_RGBA, GL_FLOAT);
+    FrameBuffer frameBuffer;
+    frameBuffer.Attach(FrameBuffer::Attachment::Color0, texture);
+    frameBuffer.Bind();
+    glViewport(0, 0, ctx.width, ctx.height);
+    const float clearColor[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+    glClearBufferfv(GL_COLOR, 0, clearColor);
+    if (instanceCount > 0)
+    {
+        // 沿用主通道已绑定的点云 / 索引缓冲与混合函数，调用方随后会恢复深度测试
+        glDisable(GL_DEPTH_TEST);
+        m_shader->use();
+        SetDrawUniforms(*m_shader, ctx, instanceCount);
+        m_shader->setFloat("u_depthPrepassAlpha", 0.0f);
+        DrawInstances(instanceCount);
+        m_shader->unuse();
+    }
+
+    m_capture.width = ctx.width;
+    m_capture.height = ctx.height;
+    std::copy(ctx.viewMatrix, ctx.viewMatrix + 16, m_capture.viewMatrix);
+    std::copy(ctx.projMatrix, ctx.projMatrix + 16, m_capture.projMatrix);
+    m_capture.pixels.resize(static_cast<size_t>(ctx.width) * ctx.height * 4);
+    glPixelStorei(GL_PACK_ALIGNMENT, 4);
+    glReadPixels(0, 0, ctx.width, ctx.height, GL_RGBA, GL_FLOAT, m_capture.pixels.data());
+    frameBuffer.Unbind();
+    frameBuffer.Detach(FrameBuffer::Attachment::Color0);
+    glDeleteTextures(1, &texture);
+    m_captureReady = true;
+    LOG_CORE_INFO("SplatPass: captured {}x{} ({} instances)", ctx.width, ctx.height, instanceCount);
+}
+
+bool SplatPass::UpdateMotion(const RenderContext &ctx)
+{
+    const auto now = std::chrono::steady_clock::now();
+    if (std::memcmp(m_lastView, ctx.viewMatrix, sizeof(m_lastView)) != 0 ||
+        std::memcmp(m_lastProj, ctx.projMatrix, sizeof(m_lastProj)) != 0)
+    {
+        std::memcpy(m_lastView, ctx.viewMatrix, sizeof(m_lastView));
+        std::memcpy(m_lastProj, ctx.projMatrix, sizeof(m_lastProj));
+        m_lastMotion = now;
+    }
+    if (!m_pointPreview)
+        return false;
+    const auto still = std::chrono::duration_cast<std::chrono::milliseconds>(now - m_lastMotion).count();
+    return still < static_cast<long long>(m_config.splatPointPreviewStillMs);
+}
+
+void SplatPass::DrawPoints(RenderContext &ctx)
+{
+    // LOD 树的合成点云中叶子（原始高斯）排在前面，预览只画叶子
+    const size_t pointCount = m_lodTree.IsEmpty() ? m_layout.count : m_lodTree.GetLeafCount();
+
+    // 点之间需要深度测试才能正确遮挡，写入 G-Buffer 深度的副本，后续 Pass 读取的 gDepthTex 不含点
+    EnsureDepthTexture(ctx.width, ctx.height);
+    glCopyImageSubData(ctx.gDepthTex, GL_TEXTURE_2D, 0, 0, 0, 0, m_depthTexture, GL_TEXTURE_2D, 0, 0, 0, 0, ctx.width,
+                       ctx.height, 1);
+
+    m_frameBuffer.Attach(FrameBuffer::Attachment::Color0, ctx.lightingTex);
+    m_frameBuffer.Attach(FrameBuffer::Attachment::Depth, m_depthTexture);
+    m_frameBuffer.Bind();
+
+    glViewport(0, 0, ctx.width, ctx.height);
+    glEnable(GL_DEPTH_TEST);
+    glDepthFunc(GL_LESS);
+    glDepthMask(GL_TRUE);
+    glDisable(GL_BLEND);
+    glEnable(GL_PROGRAM_POINT_SIZE);
+
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, CLOUD_BINDING, m_cloudBuffer);
+    m_pointShader->use();
+    SetDrawUniforms(*m_pointShader, ctx, pointCount);
+    m_pointShader->setFloat("u_pointSize", m_config.splatPointSize);
+    glBindVertexArray(m_vao);
+    glDrawArrays(GL_POINTS, 0, static_cast<GLsizei>(pointCount));
+    glBindVertexArray(0);
+    m_pointShader->unuse();
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, CLOUD_BINDING, 0);
+
+    glDisable(GL_PROGRAM_POINT_SIZE);
+    glDepthFunc(GL_LEQUAL);
+    m_frameBuffer.Unbind();
+}
+
+void SplatPass::SetDrawUniforms(const Shader &shader, const RenderContext &ctx, size_t instanceCount) const
+{
+    // 像素焦距与半视场角正切由投影矩阵推出：P[0][0] = 1 / tan(fovX / 2)
+    const float width = static_cast<float>(ctx.width);
+    const float height = static_cast<float>(ctx.height);
+    const float focalX = ctx.projMatrix[0] * width * 0.5f;
+    const float focalY = ctx.projMatrix[5] * height * 0.5f;
+
+    float camX = 0.0f;
+    float camY = 0.0f;
+    float camZ = 0.0f;
+    if (ctx.camera)
+        ctx.camera->getPosition(camX, camY, camZ);
+
+    auto offset = [this](GaussianCloud::Attribute attr) { return m_layout.offsets[static_cast<int>(attr)]; };
+
+    shader.setMat4("view", ctx.viewMatrix);
+    shader.setMat4("projection", ctx.projMatrix);
+    shader.setVec3("u_viewPos", camX, camY, camZ);
+    shader.setVec2("u_viewport", width, height);
+    shader.setVec2("u_focal", focalX, focalY);
+    shader.setVec2("u_tanHalfFov", 1.0f / ctx.projMatrix[0], 1.0f / ctx.projMatrix[5]);
+    shader.setFloat("u_nearClip", SPLAT_NEAR_CLIP);
+    shader.setUint("u_instanceCount", static_cast<unsigned int>(instanceCount));
+    shader.setInt("u_identityOrder", m_identityOrder ? 1 : 0);
+    shader.setInt("u_preprocessed", m_indirectDraw ? 1 : 0);
+    shader.setUint("u_splatCount", m_layout.count);
+    shader.setUint("u_positionOffset", offset(GaussianCloud::Attribute::Position));
+    shader.setUint("u_covarianceOffset", offset(GaussianCloud::Attribute::Covariance));
+    shader.setUint("u_opacityOffset", offset(GaussianCloud::Attribute::Opacity));
+    shader.setUint("u_shDCOffset", offset(GaussianCloud::Attribute::SHDC));
+    shader.setUint("u_shRestOffset", offset(GaussianCloud::Attribute::SHRest));
+    shader.setUint("u_shRestCoeffCount",
+                   static_cast<unsigned int>(GaussianCloud::GetSHRestCoeffCount(m_layout.shDegree)));
+    shader.setInt("u_shDegree", m_layout.shDegree);
+    shader.setInt("u_splatCompressed", m_layout.compressed ? 1 : 0);
+    if (m_layout.compressed)
+    {
+        shader.setUint("u_chunkOffset", m_layout.chunkOffset);
+        shader.setUint("u_shOffset", m_layout.shOffset);
+        shader.setUint("u_shWordsPerSplat", m_layout.shWordsPerSplat);
+        shader.setInt("u_shEncoding", m_layout.shEncoding);
+        shader.setUint("u_shCodebookOffset", m_layout.shCodebookOffset);
+        shader.setInt("u_shCodebookDim", m_layout.shCodebookDim);
+    }
+    if (m_config.splatSHLod)
+    {
+        shader.setVec3("u_shLodRadius", m_config.splatSHLodRadius[0], m_config.splatSHLodRadius[1],
+                       m_config.splatSHLodRadius[2]);
+        shader.setVec3("u_shLodDistance", m_config.splatSHLodDistance[0], m_config.splatSHLodDistance[1],
+                       m_config.splatSHLodDistance[2]);
+    }
+    else
+    {
+        shader.setVec3("u_shLodRadius", 0.0f, 0.0f, 0.0f);
+        shader.setVec3("u_shLodDistance", 0.0f, 0.0f, 0.0f);
+    }
+}
+
+void SplatPass::DrawInstances(size_t instanceCount) const
+{
+    if (m_indirectDraw)
+    {
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, m_preprocessor->GetCommandBuffer());
+        glDrawArraysIndirect(GL_TRIANGLE_STRIP, nullptr);
+        glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+    }
+    else
+    {
+        glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(instanceCount));
+    }
+}
+
+void SplatPass::Execute(RenderContext &ctx)
+{
+    if (!m_cloud || m_cloudBuffer == 0 || ctx.width <= 0 || ctx.height <= 0)
+        return;
+
+    // 相机移动期间只画点，不做剔除与排序
+    if (UpdateMotion(ctx))
+    {
+        DrawPoints(ctx);
+        m_showingPoints = true;
+        return;
+    }
+    if (m_showingPoints)
+    {
+        // 预览期间没有提交排序，恢复时等待一次当前视图的完整结果，避免沿用移动前的顺序
+        m_showingPoints = false;
+        m_orderVersion = 0;
+    }
+
+    const size_t instanceCount = UpdateOrder(ctx);
+    if (instanceCount == 0)
+    {
+        if (m_captureRequested && m_blendMode == SplatBlendMode::Sorted)
+            Capture(ctx, 0);
+        return;
+    }
+
+    // 深度预通道在 G-Buffer 深度的副本上写入，后续 Pass 读取的 gDepthTex 不含高斯
+    unsigned int depthTexture = ctx.gDepthTex;
+    if (m_depthShader)
+    {
+        EnsureDepthTexture(ctx.width, ctx.height);
+        glCopyImageSubData(ctx.gDepthTex, GL_TEXTURE_2D, 0, 0, 0, 0, m_depthTexture, GL_TEXTURE_2D, 0, 0, 0, 0,
+                           ctx.width, ctx.height, 1);
+        depthTexture = m_depthTexture;
+    }
+
+    // 与 ForwardPass 相同：颜色写入 lightingTex，深度复用 G-Buffer 以被不透明物体遮挡
+    m_frameBuffer.Attach(FrameBuffer::Attachment::Color0, ctx.lightingTex);
+    m_frameBuffer.Attach(FrameBuffer::Attachment::Depth, depthTexture);
+    m_frameBuffer.Bind();
+
+    glViewport(0, 0, ctx.width, ctx.height);
+    glEnable(GL_DEPTH_TEST);
+    glDisable(GL_CULL_FACE);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, CLOUD_BINDING, m_cloudBuffer);
+    glBindVertexArray(m_vao);
+
+    if (m_depthShader)
+    {
+        // 从前往后只写深度：最近的不透明片元先写入，其后被挡住的片元直接被深度测试拒绝
+        glDepthFunc(GL_LESS);
+        glDepthMask(GL_TRUE);
+        glColorMask(GL_FALSE, GL_FALSE, GL_FALSE, GL_FALSE);
+        glDisable(GL_BLEND);
+        m_depthShader->use();
+        SetDrawUniforms(*m_depthShader, ctx, instanceCount);
+        m_depthShader->setFloat("u_depthPrepassAlpha", m_config.splatDepthPrepassAlpha);
+        DrawInstances(instanceCount);
+        m_depthShader->unuse();
+        glColorMask(GL_TRUE, GL_TRUE, GL_TRUE, GL_TRUE);
+    }
+
+    glDepthFunc(GL_LEQUAL);
+    glDepthMask(GL_FALSE);
+    glEnable(GL_BLEND);
+
+    if (m_blendMode == SplatBlendMode::WeightedOIT)
+    {
+        // 写入独立的 accum / revealage 目标，由后处理链首位的 SplatOITCompositeEffect 合成到场景颜色
+        EnsureOITTargets(ctx.width, ctx.height);
+        m_oitFrameBuffer.Attach(FrameBuffer::Attachment::Depth, depthTexture);
+        m_oitFrameBuffer.Bind();
+        const float clearAccum[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+        const float clearRevealage[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+        glClearBufferfv(GL_COLOR, 0, clearAccum);
+        glClearBufferfv(GL_COLOR, 1, clearRevealage);
+        glBlendFunci(0, GL_ONE, GL_ONE);
+        glBlendFunci(1, GL_ZERO, GL_ONE_MINUS_SRC_COLOR);
+
+        m_oitShader->use();
+        SetDrawUniforms(*m_oitShader, ctx, instanceCount);
+        m_oitShader->setFloat("u_depthPrepassAlpha", 0.0f);
+        DrawInstances(instanceCount);
+        m_oitShader->unuse();
+        m_oitFrameBuffer.Unbind();
+        if (m_captureRequested)
+        {
+            m_captureRequested = false;
+            LOG_CORE_WARN("SplatPass: capture requires sorted blending, request dropped");
+        }
+
+        ctx.splatAccumTex = m_accumTexture;
+        ctx.splatRevealageTex = m_revealageTexture;
+    }
+    else
+    {
+        glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+        m_shader->use();
+        SetDrawUniforms(*m_shader, ctx, instanceCount);
+        m_shader->setFloat("u_depthPrepassAlpha", 0.0f);
+        DrawInstances(instanceCount);
+        m_shader->unuse();
+        if (m_captureRequested)
+            Capture(ctx, instanceCount);
+    }
+    glBindVertexArray(0);
+
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, CLOUD_BINDING, 0);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, ORDER_BINDING, 0);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, PREPROCESSED_BINDING, 0);
+    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, DRAW_COMMAND_BINDING, 0);
+    glEnable(GL_DEPTH_TEST);
+    glDepthMask(GL_TRUE);
+    glDisable(GL_BLEND);
+    glEnable(GL_CULL_FACE);
+    // 覆盖 OIT 路径逐缓冲设置的混合函数
+    glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+    m_frameBuffer.Unbind();
+}
+
+RENDERER_NAMESPACE_END
@@ -0,0 +1,195 @@
+#pragma once
+
+#include "Core/RenderCore.h"
+#include "IRenderPass.h"
+#include "FrameBuffer.h"
+#include "RenderPipeline.h"
+#include "Shader.h"
+#include "Splat/AsyncSplatSorter.h"
+#include "Splat/CompressedGaussianCloud.h"
+#include "Splat/GaussianCloud.h"
+#include "Splat/GpuSplatPreprocessor.h"
+#include "Splat/GpuSplatSorter.h"
+#include "Splat/SplatChunkSet.h"
+#include "Splat/SplatCuller.h"
+#include "Splat/SplatImage.h"
+#include "Splat/SplatLodTree.h"
+#include "Splat/SplatSorter.h"
+#include <chrono>
+#include <cstdint>
+#include <memory>
+
+RENDERER_NAMESPACE_BEGIN
+
+class ShaderManager;
+struct RenderContext;
+
+/// 高斯点云渲染 Pass：每个高斯绘制一个实例化四边形面片，按从后往前的顺序预乘 alpha 混合到 lightingTex
+///
+/// 点云整块存储上传为 SSBO（布局见 splat_common.glsl），排序结果作为实例号 -> 高斯下标的索引 SSBO。
+/// 顶点着色器做 EWA 投影，面片沿 2D 协方差的特征向量摆放，半轴长由特征值与不透明度决定
+/// （只覆盖 α ≥ 1/255 的椭圆）；片元着色器计算高斯权重。
+/// 深度测试复用 G-Buffer 深度（不写深度），因此与不透明几何体正确遮挡，之后照常经过后处理链与 FinalPass。
+///
+/// 开启 splatCompressed 时上传 CompressedGaussianCloud（同一绑定点，各段拼接为一个缓冲），着色器中反量化，
+/// CPU 端仍用 fp32 点云剔除与排序。
+/// 排序方式按点数与配置选择：超过 splatGpuSortThreshold 用 GpuSplatSorter，
+/// 否则开启 splatAsyncSort 时用 AsyncSplatSorter，关闭时在渲染线程同步 SplatSorter。
+/// CPU 排序路径在排序前先用 SplatCuller 剔除，排序、上传与绘制的实例数都只有可见高斯的数量；
+/// SetCloud 时构建 SplatChunkSet，剔除先按块进行。
+/// GPU 排序路径在开启 splatGpuPreprocess 时由 GpuSplatPreprocessor 在计算着色器中完成剔除、投影与球谐求值，
+/// 顶点着色器只读取预处理结果，可见数留在 GPU 上，以 glDrawArraysIndirect 绘制。
+/// 未走 GPU 排序、点数达到 splatLodMinSplats 且开启 splatLod 时改为构建 SplatLodTree，上传并绘制叶子 + 合并节点，
+/// 每帧由 SplatLodTree::Select 的结果（含相同阈值的不透明度与大小剔除）代替剔除结果送入 CPU 排序。
+/// 开启 splatDepthPrepass 时先把 G-Buffer 深度复制到自有深度纹理，按从前往后的顺序只把近乎不透明的片元写入其中，
+/// 主通道再对其做深度测试，G-Buffer 深度本身保持不变。
+/// 混合方式为 SplatBlendMode::WeightedOIT 时跳过排序（仍做剔除 / LOD 选择），以加权混合 OIT 写入 accum 与 revealage
+/// 两个目标并通过 RenderContext 交给后处理链中的 SplatOITCompositeEffect 合成，可随时用 SetBlendMode 切换。
+/// 开启点云预览时，视图或投影矩阵变化后的 splatPointPreviewStillMs 毫秒内只画高斯中心点（point.vs.glsl），
+/// 跳过剔除、排序与上传，静止后恢复完整渲染。
+/// RequestCapture 后的下一帧完整渲染会把高斯单独重画到清零的 RGBA32F 目标并读回（SplatImage），
+/// 用于与 SplatRasterizer 渲染同一视图的结果对照，验证 GL 路径。
+/// 通常通过 RenderPipeline::InsertPassAfter("LightingPass", ...) 插入管线。
+class RENDERER_API SplatPass : public IRenderPass
+{
+public:
+    /// 加载 splat 着色器，失败时抛出 std::runtime_error
+    SplatPass(ShaderManager &shaderManager, const RenderPipelineConfig &config);
+    ~SplatPass() override;
+
+    SplatPass(const SplatPass &) = delete;
+    SplatPass &operator=(const SplatPass &) = delete;
+
+    /// 设置要渲染的点云（需已计算 Covariance 属性），上传 SSBO 并重置排序器；传入 nullptr 清空
+    /// shCodebook 只在 splatCompressed 时使用，数量与阶数须与点云一致
+    void SetCloud(const std::shared_ptr<GaussianCloud> &cloud,
+                  const std::shared_ptr<const SHCodebook> &shCodebook = nullptr);
+    const std::shared_ptr<GaussianCloud> &GetCloud() const
+    {
+        return m_cloud;
+    }
+
+    /// 运行时切换精确排序混合 / 加权混合 OIT
+    void SetBlendMode(SplatBlendMode mode);
+    SplatBlendMode GetBlendMode() const
+    {
+        return m_blendMode;
+    }
+
+    /// 运行时开关点云预览
+    void SetPointPreview(bool enabled);
+    bool IsPointPreviewEnabled() const
+    {
+        return m_pointPreview;
+    }
+
+    /// 请求读回下一帧完整渲染的高斯（仅排序混合模式，点云预览期间顺延）：按同一顺序重画到清零的 RGBA32F 目标，
+    /// 不做深度测试、不叠加场景，像素约定与 SplatRasterizer::GetImage 相同
+    void RequestCapture();
+    /// 取出已完成的读回结果（含当帧视图与投影矩阵），没有时返回 false
+    bool TakeCapture(SplatImage &image);
+
+    void Execute(RenderContext &ctx) override;
+    const char *GetName() const override
+    {
+        return "SplatPass";
+    }
+
+private:
+    enum class SortBackend
+    {
+        Sync,
+        Async,
+        Gpu
+    };
+
+    /// 点云 SSBO 的布局，对应 splat_common.glsl / splat_compressed.glsl 的 uniform（偏移以 32 位字为单位）
+    struct CloudLayout
+    {
+        unsigned int count = 0;
+        int shDegree = 0;
+        unsigned int offsets[static_cast<int>(GaussianCloud::Attribute::Count)] = {};
+        bool compressed = false;
+        unsigned int chunkOffset = 0;
+        unsigned int shOffset = 0;
+        unsigned int shWordsPerSplat = 0;
+        int shEncoding = 0;
+        unsigned int shCodebookOffset = 0;
+        int shCodebookDim = 0;
+    };
+
+    void ReleaseBuffers();
+    /// 按 fp32 SoA 存储原样上传点云
+    void UploadCloud(const GaussianCloud &cloud);
+    /// 上传 LOD 树：原点云作为叶子，内部节点按属性平面拼接在其后
+    void UploadLod(const GaussianCloud &cloud);
+    /// 排序使用的位置平面（有 LOD 树时为全部节点），返回点数
+    size_t GetSortPositions(const float *position[3]) const;
+    /// 量化为 CompressedGaussianCloud（球谐编码由 splatCompressedHalfSH 选择）后上传，CPU 端不保留压缩数据
+    void UploadCompressed(const GaussianCloud &cloud, const std::shared_ptr<const SHCodebook> &shCodebook);
+    /// 按当前视图更新排序结果，返回本帧可绘制的实例数
+    size_t UpdateOrder(const RenderContext &ctx);
+    void UploadOrder(const uint32_t *order, size_t count);
+    /// GPU 预处理路径的 UpdateOrder：派发预处理（排序模式下再排序），返回实例数上界
+    size_t Preprocess(const RenderContext &ctx);
+    /// 按本帧路径发出实例化绘制：间接绘制或 instanceCount 个实例
+    void DrawInstances(size_t instanceCount) const;
+    /// 设置主通道与深度预通道共用的视图与点云布局 uniform
+    void SetDrawUniforms(const Shader &shader, const RenderContext &ctx, size_t instanceCount) const;
+    /// 按渲染尺寸（重新）创建深度预通道使用的深度纹理
+    void EnsureDepthTexture(int width, int height);
+    /// 按渲染尺寸（重新）创建 OIT 的 accum / revealage 目标
+    void EnsureOITTargets(int width, int height);
+    void ReleaseOITTargets();
+    /// 记录相机变化，返回本帧是否应以点云预览代替完整渲染
+    bool UpdateMotion(const RenderContext &ctx);
+    void DrawPoints(RenderContext &ctx);
+    /// 在主通道的绘制状态下把本帧实例重画到临时读回目标，结果存入 m_capture
+    void Capture(const RenderContext &ctx, size_t instanceCount);
+
+    ShaderManager &m_shaderManager;
+    RenderPipelineConfig m_config;
+    std::shared_ptr<Shader> m_shader;
+    std::shared_ptr<Shader> m_depthShader; // 深度预通道，未开启时为空
+    std::shared_ptr<Shader> m_oitShader;
+    std::shared_ptr<Shader> m_pointShader;
+    FrameBuffer m_frameBuffer;
+    unsigned int m_vao = 0;
+    unsigned int m_depthTexture = 0; // G-Buffer 深度 + 近乎不透明高斯的深度
+    int m_depthWidth = 0;
+    int m_depthHeight = 0;
+    FrameBuffer m_oitFrameBuffer;
+    unsigned int m_accumTexture = 0;     // RGBA32F：Σ w·(预乘颜色, α)
+    unsigned int m_revealageTexture = 0; // R16F：Π (1 - α)
+    int m_oitWidth = 0;
+    int m_oitHeight = 0;
+
+    std::shared_ptr<GaussianCloud> m_cloud;
+    unsigned int m_cloudBuffer = 0; // 整块 GaussianCloud 存储、LOD 叶子 + 内部节点或压缩数据
+    CloudLayout m_layout;
+    unsigned int m_orderBuffer = 0; // CPU 排序结果
+    size_t m_drawCount = 0;
+
+    bool m_pointPreview = false;
+    bool m_showingPoints = false; // 上一帧是否画的是点云预览
+    float m_lastView[16] = {};
+    float m_lastProj[16] = {};
+    std::chrono::steady_clock::time_point m_lastMotion;
+    SplatBlendMode m_blendMode = SplatBlendMode::Sorted;
+    bool m_captureRequested = false;
+    bool m_captureReady = false;
+    SplatImage m_capture;
+    bool m_identityOrder = false; // 本帧未经排序且无可见列表，实例号即高斯下标
+    bool m_indirectDraw = false;  // 本帧经 GPU 预处理，实例数在间接绘制命令中
+    SortBackend m_backend = SortBackend::Sync;
+    std::unique_ptr<SplatSorter> m_sorter;
+    std::unique_ptr<AsyncSplatSorter> m_asyncSorter;
+    std::unique_ptr<GpuSplatSorter> m_gpuSorter;
+    std::unique_ptr<GpuSplatPreprocessor> m_preprocessor;
+    SplatChunkSet m_chunks;
+    SplatCuller m_culler;
+    SplatLodTree m_lodTree;
+    uint64_t m_orderVersion = 0;
+};
+
+RENDERER_NAMESPACE_END
@@ -29,6 +29,20 @@ void Texture2D::setData(const void *data, int width, int height, int channels)
     glBindTexture(GL_TEXTURE_2D, 0);
 }
 
+void Texture2D::setFloatData(const float *data, int width, int height, int channels)
+{
+    m_width = width;
+    m_height = height;
+    m_channels = channels;
+    glBindTexture(GL_TEXTURE_2D, m_textureId);
+    GLenum format = (channels == 4) ? GL_RGBA : GL_RGB;
+    GLint internalFormat = (channels == 4) ? GL_RGBA32F : GL_RGB32F;
+    glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, format, GL_FLOAT, data);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glBindTexture(GL_TEXTURE_2D, 0);
+}
+
 void Texture2D::getData(void *data) const
 {
     glBindTexture(GL_TEXTURE_2D, m_textureId);
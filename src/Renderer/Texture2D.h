@@ -13,6 +13,8 @@ public:
     ~Texture2D();
 
     void setData(const void *data, int width, int height, int channels);
+    /// 上传 32 位浮点图像（RGBA 或 RGB），行从下往上，如 SplatRasterizer 的输出
+    void setFloatData(const float *data, int width, int height, int channels);
     void getData(void *data) const;
     void bind(int slot = 0) const;
     void unbind() const;
@@ -0,0 +1,221 @@
+// 高斯点云离线渲染：用 SplatRasterizer（CPU）渲染并保存 RGBA float 图像，不需要 GL 上下文，可在无 GPU 的批处理节点运行；
+// 也可与 SplatPass 的读回（AppDemo 中按 F12 保存的 splat_capture_N.spim）对比，验证 GL 路径
+// 构建：cmake -DBUILD_TOOLS=ON
+// 用法：
+//   SplatRenderTool render <点云 .ply/.gsc> <输出 .spim/.pfm> --view <读回 .spim>
+//       按读回中的视图、投影与尺寸渲染，并报告与该读回的差异
+//   SplatRenderTool render <点云 .ply/.gsc> <输出 .spim/.pfm> --eye x y z --target x y z [--fov 45] [--size 1280 720]
+//   SplatRenderTool diff <a.spim> <b.spim> [--threshold 0.01] [--min-psnr 0]
+//       报告 RMSE / PSNR / 最大误差，PSNR 低于 --min-psnr 时返回 1
+#include "Logger/Log.h"
+#include "ModelLoader/GaussianCloudLoader.h"
+#include "Renderer/MathUtils/Matrix.h"
+#include "Renderer/Splat/SplatImage.h"
+#include "Renderer/Splat/SplatRasterizer.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+using namespace Renderer;
+
+namespace
+{
+// 与 RenderPipeline 的相机投影一致
+const float NEAR_PLANE = 0.01f;
+const float FAR_PLANE = 1000.0f;
+const float DEG_TO_RAD = 3.14159265358979f / 180.0f;
+
+void PrintUsage()
+{
+    std::printf("usage:\n"
+                "  SplatRenderTool render <cloud.ply|.gsc> <out.spim|.pfm> --view <capture.spim>\n"
+                "  SplatRenderTool render <cloud.ply|.gsc> <out.spim|.pfm> --eye x y z --target x y z "
+                "[--fov 45] [--size 1280 720]\n"
+                "  SplatRenderTool diff <a.spim> <b.spim> [--threshold 0.01] [--min-psnr 0]\n");
+}
+
+bool EndsWith(const std::string &text, const char *suffix)
+{
+    const size_t length = std::strlen(suffix);
+    return text.size() >= length && text.compare(text.size() - length, length, suffix) == 0;
+}
+
+// 从 argv[index] 起读取 count 个浮点数，成功时 index 指向最后一个
+bool ReadFloats(int argc, char *argv[], int &index, int count, float *out)
+{
+    if (index + count >= argc)
+        return false;
+    for (int i = 0; i < count; ++i)
+        out[i] = static_cast<float>(std::atof(argv[++index]));
+    return true;
+}
+
+void PrintDifference(const SplatImage::Difference &difference, size_t pixelCount, float threshold)
+{
+    std::printf("RMSE %.6f  PSNR %.2f dB  max error %.4f  pixels over %.3f: %zu (%.3f%%)\n", difference.rmse,
+                difference.psnr, difference.maxError, threshold, difference.differingPixels,
+                100.0 * difference.differingPixels / static_cast<double>(pixelCount));
+}
+
+int RunRender(int argc, char *argv[])
+{
+    if (argc < 4)
+    {
+        PrintUsage();
+        return 2;
+    }
+    const std::string cloudPath = argv[2];
+    const std::string outputPath = argv[3];
+
+    std::string viewPath;
+    float eye[3] = {0.0f, 0.0f, 3.0f};
+    float target[3] = {0.0f, 0.0f, 0.0f};
+    float fov = 45.0f;
+    int size[2] = {1280, 720};
+    bool hasEye = false;
+    for (int i = 4; i < argc; ++i)
+    {
+        bool ok = true;
+        if (std::strcmp(argv[i], "--view") == 0 && i + 1 < argc)
+            viewPath = argv[++i];
+        else if (std::strcmp(argv[i], "--eye") == 0)
+            ok = hasEye = ReadFloats(argc, argv, i, 3, eye);
+        else if (std::strcmp(argv[i], "--target") == 0)
+            ok = ReadFloats(argc, argv, i, 3, target);
+        else if (std::strcmp(argv[i], "--fov") == 0)
+            ok = ReadFloats(argc, argv, i, 1, &fov);
+        else if (std::strcmp(argv[i], "--size") == 0 && i + 2 < argc)
+        {
+            size[0] = std::atoi(argv[++i]);
+            size[1] = std::atoi(argv[++i]);
+        }
+        else
+            ok = false;
+        if (!ok)
+        {
+            std::printf("invalid argument: %s\n", argv[i]);
+            PrintUsage();
+            return 2;
+        }
+    }
+
+    // 视图：取自读回文件，或由 --eye / --target 构造（与 Camera 相同的 LookAt + 透视投影）
+    SplatImage reference;
+    SplatImage image;
+    if (!viewPath.empty())
+    {
+        if (!reference.Load(viewPath))
+        {
+            std::printf("failed to read capture: %s\n", viewPath.c_str());
+            return 1;
+        }
+        image.width = reference.width;
+        image.height = reference.height;
+        std::copy(reference.viewMatrix, reference.viewMatrix + 16, image.viewMatrix);
+        std::copy(reference.projMatrix, reference.projMatrix + 16, image.projMatrix);
+    }
+    else if (hasEye && size[0] > 0 && size[1] > 0)
+    {
+        image.width = size[0];
+        image.height = size[1];
+        const Mat4 view = Mat4::LookAt(Vector3(eye[0], eye[1], eye[2]), Vector3(target[0], target[1], target[2]),
+                                       Vector3(0.0f, 1.0f, 0.0f));
+        const Mat4 proj = Mat4::Perspective(fov * DEG_TO_RAD, static_cast<float>(size[0]) / static_cast<float>(size[1]),
+                                            NEAR_PLANE, FAR_PLANE);
+        std::copy(view.data(), view.data() + 16, image.viewMatrix);
+        std::copy(proj.data(), proj.data() + 16, image.projMatrix);
+    }
+    else
+    {
+        std::printf("render needs --view <capture.spim> or --eye/--target\n");
+        PrintUsage();
+        return 2;
+    }
+
+    GSEngine::GaussianCloudLoader loader;
+    std::shared_ptr<GaussianCloud> cloud = loader.loadCloud(cloudPath);
+    if (!cloud)
+        return 1;
+
+    SplatRasterizer rasterizer;
+    rasterizer.Render(*cloud, image.viewMatrix, image.projMatrix, image.width, image.height);
+    image.pixels = rasterizer.GetImage();
+    const SplatRasterizer::Stats &stats = rasterizer.GetStats();
+    std::printf("rendered %dx%d: %zu visible splats, %zu tile instances, %.2f ms\n", image.width, image.height,
+                stats.visibleCount, stats.instanceCount, stats.milliseconds);
+
+    const bool saved = EndsWith(outputPath, ".pfm") ? image.SavePFM(outputPath) : image.Save(outputPath);
+    if (!saved)
+    {
+        std::printf("failed to write %s\n", outputPath.c_str());
+        return 1;
+    }
+
+    if (!viewPath.empty())
+    {
+        SplatImage::Difference difference;
+        const float threshold = 0.01f;
+        SplatImage::Compare(image, reference, threshold, difference);
+        std::printf("vs %s: ", viewPath.c_str());
+        PrintDifference(difference, image.pixels.size() / 4, threshold);
+    }
+    return 0;
+}
+
+int RunDiff(int argc, char *argv[])
+{
+    if (argc < 4)
+    {
+        PrintUsage();
+        return 2;
+    }
+    float threshold = 0.01f;
+    float minPsnr = 0.0f;
+    for (int i = 4; i < argc; ++i)
+    {
+        bool ok = false;
+        if (std::strcmp(argv[i], "--threshold") == 0)
+            ok = ReadFloats(argc, argv, i, 1, &threshold);
+        else if (std::strcmp(argv[i], "--min-psnr") == 0)
+            ok = ReadFloats(argc, argv, i, 1, &minPsnr);
+        if (!ok)
+        {
+            std::printf("invalid argument: %s\n", argv[i]);
+            PrintUsage();
+            return 2;
+        }
+    }
+
+    SplatImage a, b;
+    if (!a.Load(argv[2]) || !b.Load(argv[3]))
+    {
+        std::printf("failed to read %s\n", a.pixels.empty() ? argv[2] : argv[3]);
+        return 1;
+    }
+    if (!std::equal(a.viewMatrix, a.viewMatrix + 16, b.viewMatrix) ||
+        !std::equal(a.projMatrix, a.projMatrix + 16, b.projMatrix))
+        std::printf("warning: images were rendered from different views\n");
+
+    SplatImage::Difference difference;
+    if (!SplatImage::Compare(a, b, threshold, difference))
+    {
+        std::printf("size mismatch: %dx%d vs %dx%d\n", a.width, a.height, b.width, b.height);
+        return 1;
+    }
+    PrintDifference(difference, a.pixels.size() / 4, threshold);
+    return difference.psnr >= minPsnr ? 0 : 1;
+}
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    Logger::Log::Init();
+    if (argc >= 2 && std::strcmp(argv[1], "render") == 0)
+        return RunRender(argc, argv);
+    if (argc >= 2 && std::strcmp(argv[1], "diff") == 0)
+        return RunDiff(argc, argv);
+    PrintUsage();
+    return 2;
+}